@@ -18,9 +18,9 @@ namespace glz
       template <>
       struct read<binary>
       {
-         template <class T, class It0, class It1>
-         static void op(T&& value, It0&& it, It1&& end) {
-            from_binary<std::decay_t<T>>::op(std::forward<T>(value), std::forward<It0>(it), std::forward<It1>(end));
+         template <auto& Opts, class T, class Ctx, class It0, class It1>
+         static void op(T&& value, Ctx&& ctx, It0&& it, It1&& end) {
+            from_binary<std::decay_t<T>>::template op<Opts>(std::forward<T>(value), std::forward<Ctx>(ctx), std::forward<It0>(it), std::forward<It1>(end));
          }
       };
       
@@ -28,14 +28,16 @@ namespace glz
       requires(num_t<T> || char_t<T> || glaze_enum_t<T>)
       struct from_binary<T>
       {
-         static void op(auto&& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto&& value, auto&& ctx, auto&& it, auto&& end)
          {
             using V = std::decay_t<T>;
-            if (it != end) {
+            if (it != end) [[likely]] {
                std::memcpy(&value, &(*it), sizeof(V));
             }
-            else {
-               throw std::runtime_error("Missing binary data");
+            else [[unlikely]] {
+               ctx.error = error_code::missing_binary_data;
+               return;
             }
             std::advance(it, sizeof(V));
          }
@@ -44,8 +46,13 @@ namespace glz
       template <class T>
       requires(std::same_as<std::decay_t<T>, bool> || std::same_as<std::decay_t<T>, std::vector<bool>::reference>) struct from_binary<T>
       {
-         static void op(auto&& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto&& value, auto&& ctx, auto&& it, auto&& end)
          {
+            if (it == end) [[unlikely]] {
+               ctx.error = error_code::missing_binary_data;
+               return;
+            }
             value = static_cast<bool>(*it);
             ++it;
          }
@@ -54,7 +61,8 @@ namespace glz
       template <func_t T>
       struct from_binary<T>
       {
-         static void op(auto&& /*value*/, auto&& /*it*/, auto&& /*end*/)
+         template <auto& Opts>
+         static void op(auto&& /*value*/, auto&& /*ctx*/, auto&& /*it*/, auto&& /*end*/)
          {
          }
       };
@@ -127,11 +135,17 @@ namespace glz
       template <str_t T>
       struct from_binary<T>
       {
-         static void op(auto&& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto&& value, auto&& ctx, auto&& it, auto&& end)
          {
             const auto n = int_from_header(it, end);
             using V = typename std::decay_t<T>::value_type;
             const auto n_bytes = sizeof(V) * n;
+            // the size comes from the input, so it is checked before anything is copied
+            if (static_cast<size_t>(std::distance(it, end)) < n_bytes) [[unlikely]] {
+               ctx.error = error_code::missing_binary_data;
+               return;
+            }
             value.resize(n);
             std::memcpy(value.data(), &(*it), n_bytes);
             std::advance(it, n_bytes);
@@ -141,12 +155,15 @@ namespace glz
       template <array_t T>
       struct from_binary<T>
       {
-         static void op(auto&& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto&& value, auto&& ctx, auto&& it, auto&& end)
          {
             using V = typename std::decay_t<T>::value_type;
             if constexpr (has_static_size<T>) {
                for (auto&& item : value) {
-                  read<binary>::op(item, it, end);
+                  read<binary>::op<Opts>(item, ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
                }
             }
             else {
@@ -156,11 +173,14 @@ namespace glz
                   value.resize(n);
                }
                else if (n != value.size()) {
-                  throw std::runtime_error("Attempted to read into non resizable container with the wrong number of items.");
+                  ctx.error = error_code::wrong_array_size;
+                  return;
                }
 
                for (auto&& item: value) {
-                  read<binary>::op(item, it, end);
+                  read<binary>::op<Opts>(item, ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
                }
             }
          }
@@ -169,14 +189,19 @@ namespace glz
       template <map_t T>
       struct from_binary<T>
       {
-         static void op(auto&& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto&& value, auto&& ctx, auto&& it, auto&& end)
          {
             const auto n = int_from_header(it, end);
 
             for (size_t i = 0; i < n; ++i) {
                static thread_local typename T::key_type key{};
-               read<binary>::op(key, it, end);
-               read<binary>::op(value[key], it, end);
+               read<binary>::op<Opts>(key, ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+               read<binary>::op<Opts>(value[key], ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
             }
          };
       };
@@ -184,7 +209,8 @@ namespace glz
       template <nullable_t T>
       struct from_binary<T>
       {
-         static void op(auto&& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto&& value, auto&& ctx, auto&& it, auto&& end)
          {
             bool has_value = static_cast<bool>(*it);
             ++it;
@@ -197,7 +223,7 @@ namespace glz
                else if constexpr (is_specialization_v<T, std::shared_ptr>)
                   value = std::make_shared<typename T::element_type>();
 
-               read<binary>::op(*value, it, end);
+               read<binary>::op<Opts>(*value, ctx, it, end);
             }
             else {
                if constexpr (is_specialization_v<T, std::optional>)
@@ -210,31 +236,51 @@ namespace glz
          }
       };
       
+      template <>
+      struct from_binary<std::monostate>
+      {
+         template <auto& Opts>
+         static void op(auto&& /*value*/, auto&& /*ctx*/, auto&& /*it*/, auto&& /*end*/)
+         {}
+      };
+      
+      template <is_variant T>
+      struct from_binary<T>
+      {
+         template <auto& Opts>
+         static void op(auto&& value, auto&& ctx, auto&& it, auto&& end)
+         {
+            if (it == end) [[unlikely]] {
+               ctx.error = error_code::missing_binary_data;
+               return;
+            }
+            const auto index = int_from_header(it, end);
+            if (index >= std::variant_size_v<T>) [[unlikely]] {
+               ctx.error = error_code::no_matching_variant_type;
+               return;
+            }
+            emplace_runtime_variant(value, index);
+            std::visit([&](auto&& v) { read<binary>::op<Opts>(v, ctx, it, end); }, value);
+         }
+      };
+      
       template <class T>
       requires glaze_object_t<T>
       struct from_binary<T>
       {
-         static void op(auto&& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto&& value, auto&& ctx, auto&& it, auto&& end)
          {
             const auto n_keys = int_from_header(it, end);
             
-            static constexpr auto frozen_map = detail::make_int_map<T>();
+            static constexpr auto N = std::tuple_size_v<meta_t<T>>;
             
             for (size_t i = 0; i < n_keys; ++i) {
                const auto key = int_from_header(it, end);
-               const auto& member_it = frozen_map.find(key);
-               if (member_it != frozen_map.end()) {
-                  std::visit(
-                     [&](auto&& member_ptr) {
-                        using V = std::decay_t<decltype(member_ptr)>;
-                        if constexpr (std::is_member_pointer_v<V>) {
-                           read<binary>::op(value.*member_ptr, it, end);
-                        }
-                        else {
-                           read<binary>::op(member_ptr(value), it, end);
-                        }
-                     },
-                     member_it->second);
+               if (key < N) {
+                  visit_member<T>(value, key, [&](auto&& member) { read<binary>::op<Opts>(member, ctx, it, end); });
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
                }
             }
          }
@@ -244,11 +290,14 @@ namespace glz
       requires glaze_array_t<T>
       struct from_binary<T>
       {
-         static void op(auto&& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto&& value, auto&& ctx, auto&& it, auto&& end)
          {
             using V = std::decay_t<T>;
             for_each<std::tuple_size_v<meta_t<V>>>([&](auto I) {
-               read<binary>::op(value.*std::get<I>(meta_v<V>), it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+               read<binary>::op<Opts>(value.*std::get<I>(meta_v<V>), ctx, it, end);
             });
          }
       };
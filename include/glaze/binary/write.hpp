@@ -145,6 +145,26 @@ namespace glz
          }
       };
       
+      template <>
+      struct to_binary<std::monostate>
+      {
+         template <auto& Opts>
+         static void op(auto&& /*value*/, auto&& /*b*/) noexcept
+         {}
+      };
+      
+      // the index of the alternative as a compressed integer, followed by its value
+      template <is_variant T>
+      struct to_binary<T>
+      {
+         template <auto& Opts>
+         static void op(auto&& value, auto&& b)
+         {
+            dump_int(value.index(), b);
+            std::visit([&](auto&& v) { write<binary>::op<Opts>(v, b); }, value);
+         }
+      };
+      
       template <class T>
       requires glaze_object_t<T>
       struct to_binary<T>
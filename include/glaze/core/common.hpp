@@ -3,6 +3,11 @@
 
 #pragma once
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
 #include <string>
 #include <type_traits>
 #include <tuple>
@@ -12,6 +17,7 @@
 #include "frozen/unordered_map.h"
 
 #include "glaze/core/meta.hpp"
+#include "glaze/util/for_each.hpp"
 #include "glaze/util/string_view.hpp"
 #include "glaze/util/variant.hpp"
 #include "glaze/util/tuple.hpp"
@@ -182,6 +188,35 @@ namespace glz
       static constexpr std::string_view name = "raw_json";
    };
 
+   // a view of unparsed JSON in the source buffer, which must outlive it
+   struct raw_json_view
+   {
+      std::string_view str;
+   };
+
+   template <>
+   struct meta<raw_json_view>
+   {
+      static constexpr std::string_view name = "raw_json_view";
+   };
+
+   // destroys a value allocated from a memory resource, so it can be owned by a std::unique_ptr
+   template <class T>
+   struct pmr_deleter
+   {
+      std::pmr::memory_resource* resource = std::pmr::get_default_resource();
+
+      void operator()(T* ptr) const
+      {
+         ptr->~T();
+         resource->deallocate(ptr, sizeof(T), alignof(T));
+      }
+   };
+
+   // a std::unique_ptr that reading allocates from context::resource, see from_json<nullable_t>
+   template <class T>
+   using pmr_unique_ptr = std::unique_ptr<T, pmr_deleter<T>>;
+
    using basic =
       std::variant<bool, char, char8_t, unsigned char, signed char, char16_t,
                    short, unsigned short, wchar_t, char32_t, float, int,
@@ -463,77 +498,353 @@ namespace glz
       }
       
       template <class T, size_t... I>
-      constexpr auto make_int_map_impl(std::index_sequence<I...>)
+      constexpr auto make_key_int_map_impl(std::index_sequence<I...>)
       {
-         using value_t = value_tuple_variant_t<meta_t<T>>;
-         return frozen::make_unordered_map<size_t, value_t,
+         return frozen::make_unordered_map<frozen::string, size_t,
                                            std::tuple_size_v<meta_t<T>>>(
-            {std::make_pair<size_t, value_t>(
-               I,
-               std::get<1>(std::get<I>(meta_v<T>)))...});
+            {std::make_pair<frozen::string, size_t>(
+               frozen::string(std::get<0>(std::get<I>(meta_v<T>))),
+                                                    I)...});
       }
       
       template <class T>
-      constexpr auto make_int_map()
+      constexpr auto make_key_int_map()
       {
          constexpr auto indices =
             std::make_index_sequence<std::tuple_size_v<meta_t<T>>>{};
-         return make_int_map_impl<T>(indices);
+         return make_key_int_map_impl<T>(indices);
       }
       
       template <class T, size_t... I>
-      constexpr auto make_key_int_map_impl(std::index_sequence<I...>)
+      constexpr auto make_key_array_impl(std::index_sequence<I...>)
       {
-         return frozen::make_unordered_map<frozen::string, size_t,
-                                           std::tuple_size_v<meta_t<T>>>(
-            {std::make_pair<frozen::string, size_t>(
-               frozen::string(std::get<0>(std::get<I>(meta_v<T>))),
-                                                    I)...});
+         return std::array<sv, sizeof...(I)>{sv(std::get<0>(std::get<I>(meta_v<T>)))...};
       }
       
+      // keys in declaration order
       template <class T>
-      constexpr auto make_key_int_map()
+      constexpr auto make_key_array()
       {
          constexpr auto indices =
             std::make_index_sequence<std::tuple_size_v<meta_t<T>>>{};
-         return make_key_int_map_impl<T>(indices);
+         return make_key_array_impl<T>(indices);
+      }
+      
+      // the member of value that a member pointer or member function refers to
+      template <class M>
+      inline decltype(auto) get_member(auto&& value, M&& member)
+      {
+         if constexpr (std::is_member_pointer_v<std::decay_t<M>>) {
+            return (value.*member);
+         }
+         else {
+            return member(value);
+         }
+      }
+
+      template <class T, class Value, class F, size_t... I>
+      constexpr auto make_member_jump_table(std::index_sequence<I...>)
+      {
+         if constexpr (sizeof...(I) == 0) {
+            return std::array<void (*)(Value&, F&), 0>{};
+         }
+         else {
+            using R = decltype(std::declval<F&>()(get_member(std::declval<Value&>(), std::get<1>(std::get<0>(meta_v<T>)))));
+            return std::array<R (*)(Value&, F&), sizeof...(I)>{+[](Value& value, F& f) -> R {
+               return f(get_member(value, std::get<1>(std::get<I>(meta_v<T>))));
+            }...};
+         }
+      }
+
+      // Calls f with the member of value at a runtime declaration order index, which must be in range.
+      // Each member has its own entry in a table of functions, so a dispatch is one indirect call instead of a visit
+      // over a variant of every member pointer type. f must return the same type for every member.
+      template <class T, class Value, class F>
+      inline decltype(auto) visit_member(Value& value, const size_t index, F&& f)
+      {
+         static constexpr auto table = make_member_jump_table<T, Value, std::remove_reference_t<F>>(
+            std::make_index_sequence<std::tuple_size_v<meta_t<T>>>{});
+         return table[index](value, f);
+      }
+      
+      // A hash that tells the keys of an object apart, chosen at compile time by find_key_hash.
+      // It mixes the key length, a byte at an offset from the front and a byte at an offset from the back, skipping the
+      // parts that are not needed, and masks the result to index a table of key indices.
+      struct key_hash final
+      {
+         static constexpr size_t none = ~size_t{};
+
+         bool valid{}; // false if no combination separates the keys, which then fall back to a frozen map
+         bool length{};
+         size_t front = none;
+         size_t back = none;
+         size_t mask{};
+         size_t min_length{};
+         size_t max_length{};
+
+         // key must be at least min_length long
+         constexpr size_t operator()(const sv key) const noexcept
+         {
+            size_t h = length ? key.size() : 0;
+            if (front != none) {
+               h = h * 31 + static_cast<uint8_t>(key[front]);
+            }
+            if (back != none) {
+               h = h * 31 + static_cast<uint8_t>(key[key.size() - 1 - back]);
+            }
+            return h & mask;
+         }
+      };
+
+      // searches for the cheapest key_hash without collisions: fewest bytes read first, then the smallest table
+      template <size_t N>
+      constexpr key_hash find_key_hash(const std::array<sv, N>& keys)
+      {
+         key_hash h{};
+         if constexpr (N == 0 || N > 255) {
+            return h; // table slots are bytes
+         }
+         else {
+            h.min_length = keys[0].size();
+            for (auto& key : keys) {
+               h.min_length = std::min(h.min_length, key.size());
+               h.max_length = std::max(h.max_length, key.size());
+            }
+            const size_t offsets = std::min<size_t>(h.min_length, 16);
+            const size_t max_table = std::max<size_t>(64, 4 * std::bit_ceil(N));
+
+            const auto separates = [&](key_hash& candidate) {
+               for (size_t table = std::bit_ceil(N); table <= max_table; table *= 2) {
+                  candidate.mask = table - 1;
+                  std::array<bool, 1024> used{};
+                  bool unique = true;
+                  for (auto& key : keys) {
+                     auto& slot = used[candidate(key)];
+                     if (slot) {
+                        unique = false;
+                        break;
+                     }
+                     slot = true;
+                  }
+                  if (unique) {
+                     candidate.valid = true;
+                     return true;
+                  }
+               }
+               return false;
+            };
+
+            // one part
+            h.length = true;
+            if (separates(h)) return h;
+            h.length = false;
+            for (size_t i = 0; i < offsets; ++i) {
+               h.front = i;
+               if (separates(h)) return h;
+            }
+            h.front = key_hash::none;
+            for (size_t i = 0; i < offsets; ++i) {
+               h.back = i;
+               if (separates(h)) return h;
+            }
+
+            // two parts
+            h.length = true;
+            for (size_t i = 0; i < offsets; ++i) {
+               h.back = i;
+               if (separates(h)) return h;
+            }
+            h.back = key_hash::none;
+            for (size_t i = 0; i < offsets; ++i) {
+               h.front = i;
+               if (separates(h)) return h;
+            }
+            h.length = false;
+            for (size_t i = 0; i < offsets; ++i) {
+               for (size_t j = 0; j < offsets; ++j) {
+                  h.front = i;
+                  h.back = j;
+                  if (separates(h)) return h;
+               }
+            }
+
+            // three parts
+            h.length = true;
+            for (size_t i = 0; i < offsets; ++i) {
+               for (size_t j = 0; j < offsets; ++j) {
+                  h.front = i;
+                  h.back = j;
+                  if (separates(h)) return h;
+               }
+            }
+            return key_hash{};
+         }
+      }
+
+      template <class T>
+      inline constexpr auto key_hash_v = find_key_hash(make_key_array<T>());
+
+      template <class T>
+      constexpr auto make_key_hash_table()
+      {
+         constexpr auto keys = make_key_array<T>();
+         constexpr auto h = key_hash_v<T>;
+         std::array<uint8_t, h.mask + 1> table{};
+         table.fill(static_cast<uint8_t>(keys.size()));
+         for (size_t i = 0; i < keys.size(); ++i) {
+            table[h(keys[i])] = static_cast<uint8_t>(i);
+         }
+         return table;
+      }
+
+      // the declaration order index of a key of an object, or the number of keys if it is not one
+      // a hit costs one hash of at most two bytes, a table load and one memcmp to verify the key
+      template <class T>
+      inline size_t find_key(const sv key) noexcept
+      {
+         static constexpr auto keys = make_key_array<T>();
+         static constexpr auto N = keys.size();
+         static constexpr auto h = key_hash_v<T>;
+         if constexpr (N == 0) {
+            return 0;
+         }
+         else if constexpr (h.valid) {
+            static constexpr auto table = make_key_hash_table<T>();
+            if (key.size() < h.min_length || key.size() > h.max_length) [[unlikely]] {
+               return N;
+            }
+            const size_t index = table[h(key)];
+            if (index < N && keys[index].size() == key.size() &&
+                std::memcmp(keys[index].data(), key.data(), key.size()) == 0) [[likely]] {
+               return index;
+            }
+            return N;
+         }
+         else {
+            static constexpr auto frozen_map = make_key_int_map<T>();
+            const auto it = frozen_map.find(frozen::string(key));
+            return it == frozen_map.end() ? N : it->second;
+         }
       }
 
       template <class T, size_t... I>
-      constexpr auto make_enum_to_string_map_impl(std::index_sequence<I...>)
+      constexpr auto make_enum_to_index_map_impl(std::index_sequence<I...>)
       {
          using key_t = std::underlying_type_t<T>;
-         return frozen::make_unordered_map<key_t, frozen::string,
+         return frozen::make_unordered_map<key_t, size_t,
                                            std::tuple_size_v<meta_t<T>>>(
-            {std::make_pair<key_t, frozen::string>(
+            {std::make_pair<key_t, size_t>(
                static_cast<key_t>(std::get<1>(std::get<I>(meta_v<T>))),
-               frozen::string(std::get<0>(std::get<I>(meta_v<T>))))...});
+               I)...});
       }
 
       template <class T>
-      constexpr auto make_enum_to_string_map()
+      constexpr auto make_enum_to_index_map()
       {
          constexpr auto indices =
             std::make_index_sequence<std::tuple_size_v<meta_t<T>>>{};
-         return make_enum_to_string_map_impl<T>(indices);
+         return make_enum_to_index_map_impl<T>(indices);
       }
 
       template <class T, size_t... I>
-      constexpr auto make_string_to_enum_map_impl(std::index_sequence<I...>)
+      constexpr auto make_enum_value_array_impl(std::index_sequence<I...>)
       {
-         return frozen::make_unordered_map<frozen::string, T,
-                                           std::tuple_size_v<meta_t<T>>>(
-            {std::make_pair<frozen::string, T>(
-               frozen::string(std::get<0>(std::get<I>(meta_v<T>))),
-               T(std::get<1>(std::get<I>(meta_v<T>))))...});
+         return std::array<T, sizeof...(I)>{T(std::get<1>(std::get<I>(meta_v<T>)))...};
       }
 
+      // enum values in declaration order, matching the names of make_key_array
       template <class T>
-      constexpr auto make_string_to_enum_map()
+      constexpr auto make_enum_value_array()
       {
          constexpr auto indices =
             std::make_index_sequence<std::tuple_size_v<meta_t<T>>>{};
-         return make_string_to_enum_map_impl<T>(indices);
+         return make_enum_value_array_impl<T>(indices);
+      }
+
+      template <size_t N>
+      constexpr size_t quoted_size(const std::array<sv, N>& names)
+      {
+         size_t n{};
+         for (auto& name : names) {
+            n += name.size() + 2;
+         }
+         return n;
+      }
+
+      // the names of an enum with their quotes, back to back in declaration order
+      template <class T>
+      inline constexpr auto quoted_enum_chars_v = [] {
+         constexpr auto names = make_key_array<T>();
+         std::array<char, quoted_size(names)> chars{};
+         size_t i{};
+         for (auto& name : names) {
+            chars[i++] = '"';
+            for (auto c : name) {
+               chars[i++] = c;
+            }
+            chars[i++] = '"';
+         }
+         return chars;
+      }();
+
+      // the quoted name of each enum value in declaration order
+      template <class T>
+      inline constexpr auto quoted_enum_names_v = [] {
+         constexpr auto names = make_key_array<T>();
+         std::array<sv, names.size()> quoted{};
+         size_t offset{};
+         for (size_t i = 0; i < names.size(); ++i) {
+            quoted[i] = sv{quoted_enum_chars_v<T>.data() + offset, names[i].size() + 2};
+            offset += quoted[i].size();
+         }
+         return quoted;
+      }();
+
+      // the quoted name of an enum value, or an empty view if the value has no name
+      // values spanning a small range index a table directly, others are hashed
+      template <class T>
+      inline sv quoted_enum_name(const T value) noexcept
+      {
+         using key_t = std::underlying_type_t<T>;
+         static constexpr auto values = make_enum_value_array<T>();
+         static constexpr auto N = values.size();
+         if constexpr (N == 0) {
+            return {};
+         }
+         else {
+            // unsigned arithmetic, so the offset of a value is correct for signed enums too
+            static constexpr auto min = [] {
+               auto m = static_cast<key_t>(values[0]);
+               for (auto v : values) {
+                  m = std::min(m, static_cast<key_t>(v));
+               }
+               return static_cast<uint64_t>(m);
+            }();
+            static constexpr auto span = [] {
+               uint64_t s{};
+               for (auto v : values) {
+                  s = std::max(s, static_cast<uint64_t>(static_cast<key_t>(v)) - min);
+               }
+               return s;
+            }();
+
+            if constexpr (span < std::max<size_t>(2 * N, 16)) {
+               static constexpr auto table = [] {
+                  std::array<sv, span + 1> t{};
+                  for (size_t i = N; i-- > 0;) {
+                     t[static_cast<uint64_t>(static_cast<key_t>(values[i])) - min] = quoted_enum_names_v<T>[i];
+                  }
+                  return t;
+               }();
+               const auto offset = static_cast<uint64_t>(static_cast<key_t>(value)) - min;
+               return offset < table.size() ? table[offset] : sv{};
+            }
+            else {
+               static constexpr auto frozen_map = make_enum_to_index_map<T>();
+               const auto it = frozen_map.find(static_cast<key_t>(value));
+               return it == frozen_map.end() ? sv{} : quoted_enum_names_v<T>[it->second];
+            }
+         }
       }
 
       template <class T, class mptr_t>
@@ -575,6 +886,50 @@ namespace glz
 
       template <class T>
       using member_tuple_t = typename members_from_meta<T>::type;
+
+      // the key that names the alternative of a variant written as an object, e.g.
+      // template <> struct glz::meta<std::variant<A, B>> { static constexpr std::string_view tag = "type"; };
+      // without a tag the alternative is deduced from the type of the JSON value
+      template <is_variant T>
+      inline constexpr sv tag_v = [] {
+         if constexpr (requires { meta<T>::tag; }) {
+            return sv{meta<T>::tag};
+         }
+         else {
+            return sv{};
+         }
+      }();
+
+      // the tag value of each alternative, meta<T>::ids if given, otherwise the name of the alternative
+      template <is_variant T>
+      inline constexpr auto ids_v = [] {
+         constexpr auto N = std::variant_size_v<T>;
+         if constexpr (requires { meta<T>::ids; }) {
+            static_assert(std::size(meta<T>::ids) == N, "a variant needs one id per alternative");
+            return [&]<size_t... I>(std::index_sequence<I...>) {
+               return std::array<sv, N>{sv{meta<T>::ids[I]}...};
+            }(std::make_index_sequence<N>{});
+         }
+         else {
+            return []<size_t... I>(std::index_sequence<I...>) {
+               return std::array<sv, N>{name_v<std::variant_alternative_t<I, T>>...};
+            }(std::make_index_sequence<N>{});
+         }
+      }();
+
+      // switches a variant to the alternative at a runtime index, keeping the current value if it is already there
+      template <is_variant T>
+      inline void emplace_runtime_variant(T& variant, const size_t index)
+      {
+         if (variant.index() == index) {
+            return;
+         }
+         for_each<std::variant_size_v<T>>([&](auto I) {
+            if (I == index) {
+               variant.template emplace<I>();
+            }
+         });
+      }
    }  // namespace detail
 
    constexpr auto array(auto&&... args)
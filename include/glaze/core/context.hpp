@@ -0,0 +1,149 @@
+// Glaze Library
+// For the license information refer to glaze.hpp
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+
+namespace glz
+{
+   namespace detail
+   {
+      struct structural_index;
+   }
+
+   enum class error_code : uint32_t
+   {
+      none,
+      no_read_input,
+      unexpected_end,
+      syntax_error,
+      expected_true_or_false,
+      expected_null,
+      parse_number_failure,
+      number_too_long,
+      expected_quote,
+      expected_comma,
+      expected_colon,
+      expected_brace,
+      expected_end_brace,
+      expected_bracket,
+      expected_end_bracket,
+      expected_comment,
+      unexpected_enum,
+      exceeded_static_array_size,
+      invalid_nullable_read,
+      missing_binary_data,
+      wrong_array_size,
+      escaped_string_view,
+      no_matching_variant_type,
+      invalid_escape,
+      unescaped_control_character,
+      buffer_overflow,
+      read_failure
+   };
+
+   inline constexpr std::string_view error_message(const error_code ec) noexcept
+   {
+      using enum error_code;
+      switch (ec) {
+      case none:
+         return "No error";
+      case no_read_input:
+         return "No input provided to read";
+      case unexpected_end:
+         return "Unexpected end of buffer";
+      case syntax_error:
+         return "Syntax error";
+      case expected_true_or_false:
+         return "Expected true or false";
+      case expected_null:
+         return "Expected null";
+      case parse_number_failure:
+         return "Failed to parse number";
+      case number_too_long:
+         return "Number is too long";
+      case expected_quote:
+         return "Expected:\"";
+      case expected_comma:
+         return "Expected:,";
+      case expected_colon:
+         return "Expected::";
+      case expected_brace:
+         return "Expected:{";
+      case expected_end_brace:
+         return "Expected:}";
+      case expected_bracket:
+         return "Expected:[";
+      case expected_end_bracket:
+         return "Expected:]";
+      case expected_comment:
+         return "Expected / or * after /";
+      case unexpected_enum:
+         return "Unexpected enum value";
+      case exceeded_static_array_size:
+         return "Exceeded static array size";
+      case invalid_nullable_read:
+         return "Cannot read into unset nullable that is not std::optional, std::unique_ptr, or std::shared_ptr";
+      case missing_binary_data:
+         return "Missing binary data";
+      case wrong_array_size:
+         return "Attempted to read into non resizable container with the wrong number of items";
+      case escaped_string_view:
+         return "Cannot decode an escaped string into a std::string_view over a read-only buffer";
+      case no_matching_variant_type:
+         return "No variant alternative matches the JSON value or tag";
+      case invalid_escape:
+         return "Invalid escape sequence";
+      case unescaped_control_character:
+         return "Control characters in strings must be escaped";
+      case buffer_overflow:
+         return "The output does not fit in the buffer";
+      case read_failure:
+         return "Reading from the input failed";
+      }
+      return "Unknown error";
+   }
+
+   // the result of a non-throwing read, location is the byte offset where parsing stopped
+   struct parse_error final
+   {
+      error_code ec{};
+      size_t location{};
+
+      constexpr explicit operator bool() const noexcept { return ec != error_code::none; }
+
+      constexpr bool operator==(const error_code e) const noexcept { return ec == e; }
+   };
+
+   // the result of a write into a fixed size buffer, size is the bytes written or, on overflow, the bytes needed
+   struct write_result final
+   {
+      error_code ec{};
+      size_t size{};
+
+      constexpr explicit operator bool() const noexcept { return ec != error_code::none; }
+
+      constexpr bool operator==(const error_code e) const noexcept { return ec == e; }
+   };
+
+   // runtime state shared across a single read
+   struct context final
+   {
+      error_code error{}; // readers set this and return rather than throwing
+      // built lazily when opts.structural_index is enabled, in thread local storage of the reading thread, and only
+      // set for the duration of a read
+      detail::structural_index* index{};
+      std::pmr::memory_resource* resource{}; // if set, std::shared_ptr and glz::pmr_unique_ptr values are allocated from it
+
+      // clears what a previous read left behind, so a context can be reused, the resource is kept
+      void reset() noexcept
+      {
+         error = {};
+         index = nullptr;
+      }
+   };
+}
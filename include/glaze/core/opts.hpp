@@ -11,5 +11,10 @@ namespace glz
    {
       uint32_t format = json;
       bool comments = false;
+      bool structural_index = false; // index the remaining buffer on the first skipped value so later skips jump
+      bool minified = false; // trust the input to be well formed and minified: whitespace and separators are not checked
+      bool prettify = false; // write with newlines and indentation
+      char indentation_char = ' '; // used for indentation when prettifying
+      uint8_t indentation_width = 3; // characters per level of indentation when prettifying
    };
 }
@@ -4,61 +4,157 @@
 #pragma once
 
 #include "glaze/core/common.hpp"
+#include "glaze/core/context.hpp"
+#include "glaze/core/opts.hpp"
+#include "glaze/util/buffered_input.hpp"
 #include "glaze/util/validate.hpp"
 
 namespace glz
 {
-   template <opts Opts, class Buffer>
-   requires nano::ranges::input_range<std::decay_t<Buffer>> &&
-      std::same_as<std::byte, nano::ranges::range_value_t<std::decay_t<Buffer>>>
-   inline void read(auto& value, Buffer&& buffer)
+   template <class Buffer>
+   concept read_buffer = nano::ranges::input_range<std::decay_t<Buffer>> &&
+      (std::same_as<char, nano::ranges::range_value_t<std::decay_t<Buffer>>> ||
+       std::same_as<std::byte, nano::ranges::range_value_t<std::decay_t<Buffer>>>);
+
+   // Reads without throwing on malformed input. The returned location is the byte offset where parsing stopped.
+   template <opts Opts, class T, read_buffer Buffer>
+   [[nodiscard]] inline parse_error read(T& value, Buffer&& buffer, context& ctx)
    {
+      ctx.reset();
       auto b = std::ranges::begin(buffer);
       auto e = std::ranges::end(buffer);
       if (b == e) {
-         throw std::runtime_error("No input provided to read");
+         return {error_code::no_read_input};
       }
-      try {
-         detail::read<Opts.format>::op(value, b, e);
+      const auto start = b;
+      detail::read<Opts.format>::template op<Opts>(value, ctx, b, e);
+      ctx.index = nullptr; // the index belongs to this thread and this buffer, see context::index
+      if (bool(ctx.error)) [[unlikely]] {
+         return {ctx.error, static_cast<size_t>(std::distance(start, b))};
       }
-      catch (const std::exception& e) {
+      return {};
+   }
+
+   template <opts Opts, class T, class Buffer>
+   requires(std::convertible_to<std::decay_t<Buffer>, std::string_view> &&
+            !nano::ranges::input_range<std::decay_t<Buffer>>)
+   [[nodiscard]] inline parse_error read(T& value, Buffer&& buffer, context& ctx)
+   {
+      return read<Opts>(value, std::string_view{std::forward<Buffer>(buffer)}, ctx);
+   }
+
+   // Builds the line, column and surrounding context for an error, only call this when the message is needed
+   inline std::string format_error(const parse_error& pe, const auto& buffer)
+   {
+      const std::string error{error_message(pe.ec)};
+      const auto info = detail::get_source_info(buffer, pe.location);
+      if (info) {
+         return detail::generate_error_string(error, *info);
+      }
+      return error;
+   }
+
+   template <opts Opts, class Buffer>
+   requires nano::ranges::input_range<std::decay_t<Buffer>> &&
+      std::same_as<std::byte, nano::ranges::range_value_t<std::decay_t<Buffer>>>
+   inline void read(auto& value, Buffer&& buffer)
+   {
+      context ctx{};
+      const auto pe = read<Opts>(value, buffer, ctx);
+      if (pe == error_code::no_read_input) [[unlikely]] {
+         throw std::runtime_error(std::string(error_message(pe.ec)));
+      }
+      else if (pe) [[unlikely]] {
          // TODO: Implement good error message
-         throw std::runtime_error("binary read error:" + std::string(e.what()));
+         throw std::runtime_error("binary read error:" + std::string(error_message(pe.ec)));
       }
    }
-   
+
    // For reading json from a std::vector<char>, std::deque<char> and the like
    template <opts Opts, class Buffer>
    requires nano::ranges::input_range<std::decay_t<Buffer>> &&
       std::same_as<char, nano::ranges::range_value_t<std::decay_t<Buffer>>>
    inline void read(auto& value, Buffer&& buffer)
    {
-      auto b = std::ranges::begin(buffer);
-      auto e = std::ranges::end(buffer);
-      if (b == e) {
-         throw std::runtime_error("No input provided to read");
+      context ctx{};
+      const auto pe = read<Opts>(value, buffer, ctx);
+      if (pe == error_code::no_read_input) [[unlikely]] {
+         throw std::runtime_error(std::string(error_message(pe.ec)));
+      }
+      else if (pe) [[unlikely]] {
+         throw std::runtime_error(format_error(pe, buffer));
+      }
+   }
+
+   // For reading from a file descriptor or other block source, see glaze/util/buffered_input.hpp
+   template <opts Opts>
+   [[nodiscard]] inline parse_error read(auto& value, read_source auto&& source, context& ctx)
+   {
+      ctx.reset();
+      using source_t = std::decay_t<decltype(source)>;
+      detail::buffered_input<source_t> in{std::forward<decltype(source)>(source)};
+      in.refill();
+      if (in.cur == in.last) {
+         return {detail::source_failed(in.source) ? error_code::read_failure : error_code::no_read_input};
+      }
+      detail::buffered_iterator<decltype(in)> it{&in};
+      detail::read<Opts.format>::template op<Opts>(value, ctx, it, std::default_sentinel);
+      if (detail::source_failed(in.source)) [[unlikely]] {
+         ctx.error = error_code::read_failure; // the input was cut short, so the value may be incomplete
+      }
+      if (bool(ctx.error)) [[unlikely]] {
+         return {ctx.error, in.position()};
       }
-      try {
-         detail::read<Opts.format>::op(value, b, e);
+      return {};
+   }
+
+   template <opts Opts>
+   inline void read(auto& value, read_source auto&& source)
+   {
+      context ctx{};
+      const auto pe = read<Opts>(value, std::forward<decltype(source)>(source), ctx);
+      if (pe) [[unlikely]] {
+         throw std::runtime_error(std::string(error_message(pe.ec)));
       }
-      catch (const std::exception& e) {
-         auto index = std::distance(std::ranges::begin(buffer), b);
-         auto info = detail::get_source_info(buffer, index);
-         std::string error = e.what();
-         if (info) error = detail::generate_error_string(error, *info);
-         throw std::runtime_error(error);
+   }
+
+   // For reading json from std::ifstream, std::cin, or other streams
+   // The stream is read in blocks of what it has buffered, bytes past the end of the value are returned to it
+   template <opts Opts>
+   [[nodiscard]] inline parse_error read(auto& value, detail::stream_t auto& is, context& ctx)
+   {
+      ctx.reset();
+      detail::buffered_input<istream_source> in{istream_source{is}};
+      in.refill();
+      if (in.cur == in.last) {
+         return {error_code::no_read_input};
+      }
+      detail::buffered_iterator<decltype(in)> it{&in};
+      detail::read<Opts.format>::template op<Opts>(value, ctx, it, std::default_sentinel);
+      if (auto unread = in.last - in.cur; unread > 0) {
+         // the last block was taken from the stream's buffer, so it can be put back even if the stream cannot seek
+         is.clear();
+         while (unread > 0 && is.rdbuf()->sungetc() != std::char_traits<char>::eof()) {
+            --unread;
+         }
+         if (unread > 0 && !is.seekg(-static_cast<std::streamoff>(unread), std::ios_base::cur)) {
+            is.clear();
+         }
       }
+      if (bool(ctx.error)) [[unlikely]] {
+         return {ctx.error, in.position()};
+      }
+      return {};
    }
 
-   // For reading json from std::ofstream, std::cout, or other streams
    template <opts Opts>
    inline void read(auto& value, detail::stream_t auto& is)
    {
-      std::istreambuf_iterator<char> b{is}, e{};
-      if (b == e) {
-         throw std::runtime_error("No input provided to read");
+      context ctx{};
+      const auto pe = read<Opts>(value, is, ctx);
+      if (pe) [[unlikely]] {
+         throw std::runtime_error(std::string(error_message(pe.ec)));
       }
-      detail::read<Opts.format>::op(value, b, e);
    }
 
    // For reading json from stuff convertable to a std::string_view
@@ -70,7 +166,7 @@ namespace glz
    {
       const auto str = std::string_view{std::forward<Buffer>(buffer)};
       if (str.empty()) {
-         throw std::runtime_error("No input provided to read");
+         throw std::runtime_error(std::string(error_message(error_code::no_read_input)));
       }
       read<Opts>(value, str);
    }
@@ -16,7 +16,16 @@ namespace glz
    inline void write(T&& value, Buffer& buffer) noexcept
    {
       if constexpr (std::same_as<Buffer, std::string> || std::same_as<Buffer, std::vector<std::byte>>) {
-         if constexpr (Opts.format == json) {
+         if constexpr (std::same_as<Buffer, std::string> &&
+                       requires { detail::write<Opts.format>::template size_bound<Opts>(value); }) {
+            // the output is bounded before writing, so the buffer is resized once and written through a pointer with
+            // no capacity checks
+            buffer.resize(detail::write<Opts.format>::template size_bound<Opts>(value));
+            auto* p = buffer.data();
+            detail::write<Opts.format>::template op<Opts>(std::forward<T>(value), p);
+            buffer.resize(static_cast<size_t>(p - buffer.data()));
+         }
+         else if constexpr (Opts.format == json) {
             if (buffer.empty()) {
                buffer.resize(32);
             }
@@ -11,15 +11,11 @@
 
 #include <sstream>
 
-#ifndef FMT_HEADER_ONLY
-#define FMT_HEADER_ONLY
-#endif  // !FMT_HEADER_ONLY
-#include "fmt/format.h"
-#include "fmt/compile.h"
-
 #include "glaze/record/recorder.hpp"
 #include "glaze/util/type_traits.hpp"
 #include "glaze/util/for_each.hpp"
+#include "glaze/util/dtoa.hpp"
+#include "glaze/util/itoa.hpp"
 #include "glaze/core/common.hpp"
 
 namespace glz
@@ -33,7 +29,8 @@ namespace glz
    inline void write_csv(Buffer& buffer,
                          const T x) requires std::is_floating_point_v<T>
    {
-      fmt::format_to(std::back_inserter(buffer), FMT_COMPILE("{}"), x);
+      char chars[detail::max_float_chars<T>];
+      buffer.append(chars, static_cast<size_t>(detail::dtoa(chars, x) - chars));
    }
    
    template <class Buffer, class T>
@@ -49,7 +46,8 @@ namespace glz
          }
       }
       else {
-         fmt::format_to(std::back_inserter(buffer), FMT_COMPILE("{}"), x);
+         char chars[24];
+         buffer.append(chars, static_cast<size_t>(detail::itoa(chars, x) - chars));
       }
    }
    
@@ -240,7 +238,7 @@ namespace glz
       std::fstream file(std::string{file_name} + ".csv", std::ios::out);
       
       if (!file) {
-         throw std::runtime_error(fmt::format("csv::to_file | file '{}' could not be created", file_name));
+         throw std::runtime_error("csv::to_file | file '" + std::string{file_name} + "' could not be created");
       }
       
       file.write(buffer.data(), buffer.size());
@@ -8,3 +8,6 @@
 #include "glaze/json/json_ptr.hpp"
 #include "glaze/json/from_ptr.hpp"
 #include "glaze/json/prettify.hpp"
+#include "glaze/json/lazy.hpp"
+#include "glaze/json/read_parallel.hpp"
+#include "glaze/json/ndjson.hpp"
@@ -96,22 +96,12 @@ namespace glz
          }
 
          if constexpr (glaze_object_t<T>) {
-            static constexpr auto frozen_map = detail::make_map<T>();
-            const auto& member_it = frozen_map.find(frozen::string(key));
-            if (member_it != frozen_map.end()) {
-               return std::visit(
-                  [&](auto&& member_ptr) {
-                     using V = std::decay_t<decltype(member_ptr)>;
-                     if constexpr (std::is_member_pointer_v<V>) {
-                        return seek_impl(std::forward<F>(func),
-                                         value.*member_ptr, json_ptr);
-                     }
-                     else {
-                        return seek_impl(std::forward<F>(func),
-                                         member_ptr(value), json_ptr);
-                     }
-                  },
-                  member_it->second);
+            static constexpr auto N = std::tuple_size_v<meta_t<T>>;
+            const auto index = find_key<T>(key);
+            if (index < N) {
+               return visit_member<T>(value, index, [&](auto&& member) {
+                  return seek_impl(std::forward<F>(func), member, json_ptr);
+               });
             }
             else
                return false;
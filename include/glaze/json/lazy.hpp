@@ -0,0 +1,310 @@
+// Glaze Library
+// For the license information refer to glaze.hpp
+
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+#include "glaze/json/read.hpp"
+
+// On demand access to JSON in a contiguous buffer.
+// Nothing is parsed until it is touched: looking up a member walks the enclosing object and skips the values of
+// every other member without decoding them. Values are decoded with the regular from_json specializations.
+
+namespace glz
+{
+   enum class json_type : uint8_t
+   {
+      invalid,
+      null,
+      boolean,
+      number,
+      string,
+      object,
+      array
+   };
+
+   // A JSON value in a contiguous buffer. The buffer must outlive the view and any views taken from it.
+   // Missing members, out of range indices and malformed input produce an empty view rather than an error.
+   struct lazy_json final
+   {
+      sv json{}; // the text of the value, empty if the value does not exist
+
+      struct entry;
+      class iterator;
+
+      lazy_json() = default;
+
+      // a view of the value at the start of a buffer
+      explicit lazy_json(const sv buffer)
+      {
+         context ctx{};
+         auto it = buffer.data();
+         const auto end = buffer.data() + buffer.size();
+         detail::skip_ws(ctx, it, end);
+         if (!bool(ctx.error)) {
+            json = sv{it, static_cast<size_t>(end - it)};
+         }
+      }
+
+      explicit operator bool() const noexcept { return !json.empty(); }
+
+      json_type type() const noexcept
+      {
+         if (json.empty()) {
+            return json_type::invalid;
+         }
+         switch (json[0]) {
+         case 'n':
+            return json_type::null;
+         case 't':
+         case 'f':
+            return json_type::boolean;
+         case '"':
+            return json_type::string;
+         case '{':
+            return json_type::object;
+         case '[':
+            return json_type::array;
+         default:
+            return detail::is_numeric(json[0]) ? json_type::number : json_type::invalid;
+         }
+      }
+
+      iterator begin() const;
+      iterator end() const;
+
+      // the number of members or elements, which walks the container
+      size_t size() const;
+
+      lazy_json operator[](const sv key) const;
+      lazy_json operator[](const size_t index) const;
+
+      // the value at a JSON pointer (e.g. "/a/b/0"), using the same syntax as glz::get
+      lazy_json at(sv json_ptr) const;
+
+      // decodes the value with the regular readers, throwing on failure like glz::read_json
+      template <class T>
+      T get() const
+      {
+         T value{};
+         read<opts{}>(value, json);
+         return value;
+      }
+
+      template <class T>
+      [[nodiscard]] parse_error get(T& value) const
+      {
+         context ctx{};
+         return read<opts{}>(value, json, ctx);
+      }
+   };
+
+   // a member of an object (with its key still escaped) or an element of an array (with an empty key)
+   struct lazy_json::entry final
+   {
+      sv key{};
+      lazy_json value{};
+   };
+
+   class lazy_json::iterator final
+   {
+      const char* cur{}; // start of the current entry, nullptr at the end
+      const char* next{}; // start of the following entry, nullptr if the current entry is the last
+      const char* last{};
+      bool object{};
+      entry current{};
+
+      void parse()
+      {
+         context ctx{};
+         auto it = cur;
+         current = {};
+         if (object) {
+            if (it == last || *it != '"') {
+               cur = nullptr;
+               return;
+            }
+            const auto key_start = it + 1;
+            detail::skip_string(ctx, it, last);
+            if (bool(ctx.error)) {
+               cur = nullptr;
+               return;
+            }
+            current.key = sv{key_start, static_cast<size_t>(it - key_start - 1)};
+            detail::skip_ws(ctx, it, last);
+            detail::match<':'>(ctx, it, last);
+         }
+         detail::skip_ws(ctx, it, last);
+         if (bool(ctx.error) || it == last) {
+            cur = nullptr;
+            return;
+         }
+         const auto value_start = it;
+         static constexpr opts lazy_opts{};
+         detail::skip_object_value<lazy_opts>(ctx, it, last);
+         if (bool(ctx.error)) {
+            cur = nullptr;
+            return;
+         }
+         auto value_end = it;
+         while (value_end > value_start && static_cast<uint8_t>(value_end[-1]) < 33) {
+            --value_end;
+         }
+         current.value.json = sv{value_start, static_cast<size_t>(value_end - value_start)};
+
+         detail::skip_ws(ctx, it, last);
+         if (bool(ctx.error) || it == last) {
+            cur = nullptr;
+         }
+         else if (*it == ',') {
+            ++it;
+            detail::skip_ws(ctx, it, last);
+            next = bool(ctx.error) ? nullptr : it;
+         }
+         else {
+            next = nullptr; // closing bracket
+         }
+      }
+
+     public:
+      using iterator_category = std::input_iterator_tag;
+      using value_type = entry;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const entry*;
+      using reference = const entry&;
+
+      iterator() = default;
+
+      iterator(const lazy_json& container)
+      {
+         const auto type = container.type();
+         if (type != json_type::object && type != json_type::array) {
+            return;
+         }
+         object = type == json_type::object;
+         context ctx{};
+         auto it = container.json.data() + 1;
+         last = container.json.data() + container.json.size();
+         detail::skip_ws(ctx, it, last);
+         if (bool(ctx.error) || it == last || *it == '}' || *it == ']') {
+            return;
+         }
+         cur = it;
+         parse();
+      }
+
+      const entry& operator*() const noexcept { return current; }
+      const entry* operator->() const noexcept { return &current; }
+
+      iterator& operator++()
+      {
+         cur = next;
+         if (cur) {
+            parse();
+         }
+         return *this;
+      }
+
+      void operator++(int) { ++*this; }
+
+      bool operator==(const iterator& other) const noexcept { return cur == other.cur; }
+   };
+
+   inline lazy_json::iterator lazy_json::begin() const { return iterator{*this}; }
+   inline lazy_json::iterator lazy_json::end() const { return {}; }
+
+   inline size_t lazy_json::size() const
+   {
+      size_t n{};
+      for (auto it = begin(); it != end(); ++it) {
+         ++n;
+      }
+      return n;
+   }
+
+   inline lazy_json lazy_json::operator[](const sv key) const
+   {
+      if (type() != json_type::object) {
+         return {};
+      }
+      for (auto&& [k, value] : *this) {
+         if (k.find('\\') == sv::npos) {
+            if (k == key) {
+               return value;
+            }
+         }
+         else {
+            // escaped keys are decoded before comparing
+            static thread_local std::string decoded{};
+            context ctx{};
+            const auto quoted = sv{k.data() - 1, k.size() + 2};
+            if (!read<opts{}>(decoded, quoted, ctx) && decoded == key) {
+               return value;
+            }
+         }
+      }
+      return {};
+   }
+
+   inline lazy_json lazy_json::operator[](const size_t index) const
+   {
+      if (type() != json_type::array) {
+         return {};
+      }
+      size_t i{};
+      for (auto&& element : *this) {
+         if (i++ == index) {
+            return element.value;
+         }
+      }
+      return {};
+   }
+
+   inline lazy_json lazy_json::at(sv json_ptr) const
+   {
+      lazy_json value = *this;
+      static thread_local std::string key{};
+      while (!json_ptr.empty()) {
+         if (json_ptr[0] != '/' || !value) {
+            return {};
+         }
+         json_ptr.remove_prefix(1);
+         const auto token = json_ptr.substr(0, json_ptr.find('/'));
+         json_ptr.remove_prefix(token.size());
+
+         if (value.type() == json_type::array) {
+            size_t index{};
+            const auto [p, ec] = std::from_chars(token.data(), token.data() + token.size(), index);
+            if (ec != std::errc{} || p != token.data() + token.size()) {
+               return {};
+            }
+            value = value[index];
+         }
+         else if (token.find('~') == sv::npos) {
+            value = value[token];
+         }
+         else {
+            key.clear();
+            for (size_t i = 0; i < token.size(); ++i) {
+               auto c = token[i];
+               if (c == '~') {
+                  if (++i == token.size()) {
+                     return {};
+                  }
+                  c = token[i] == '0' ? '~' : token[i] == '1' ? '/' : '\0';
+                  if (c == '\0') {
+                     return {};
+                  }
+               }
+               key.push_back(c);
+            }
+            value = value[sv{key}];
+         }
+      }
+      return value;
+   }
+}
@@ -0,0 +1,216 @@
+// Glaze Library
+// For the license information refer to glaze.hpp
+
+#pragma once
+
+#include <functional>
+#include <iterator>
+#include <string>
+
+#include "glaze/json/read.hpp"
+#include "glaze/json/write.hpp"
+#include "glaze/util/buffered_input.hpp"
+#include "glaze/util/simd.hpp"
+
+// Newline delimited JSON (JSON Lines).
+// Records are separated by '\n', which cannot appear unescaped inside a JSON value, so lines are found with a vector
+// scan for the newline alone and each record is parsed within its line.
+
+namespace glz
+{
+   // Reads the records of newline delimited JSON one at a time into the same value, so its allocations are reused.
+   // Blank lines are skipped. Reading stops at the end of the input or at the first malformed record.
+   template <class T, opts Opts = opts{}>
+   struct ndjson_reader final
+   {
+      T value{};
+
+      // reads from a contiguous buffer, which must outlive the reader
+      explicit ndjson_reader(const sv buffer) : data(buffer) {}
+
+      // reads from a stream or other block source, a block at a time
+      explicit ndjson_reader(read_source auto&& source)
+         : source([s = std::forward<decltype(source)>(source)](char* out, const size_t n, bool& failed) mutable {
+              const auto count = static_cast<size_t>(s.read(out, n));
+              failed = detail::source_failed(s);
+              return count;
+           })
+      {}
+
+      explicit ndjson_reader(detail::stream_t auto& is) : ndjson_reader(istream_source{is}) {}
+
+      // reads the next record into value, returns false at the end of the input or on error
+      bool next()
+      {
+         if (bool(error)) [[unlikely]] {
+            return false;
+         }
+         while (true) {
+            const auto begin = data.data();
+            const auto end = begin + data.size();
+            const auto newline = detail::find_first_of<'\n'>(begin + scanned, end);
+            if (newline == end && source) {
+               // the line may continue in the next block, fill moves the unread input so it is found again
+               fill();
+               if (bool(error)) [[unlikely]] {
+                  return false;
+               }
+               continue;
+            }
+            if (begin == end) {
+               return false;
+            }
+
+            const auto line = sv{begin, static_cast<size_t>(newline - begin)};
+            const auto line_start = consumed;
+            const auto advance = newline == end ? line.size() : line.size() + 1;
+            data.remove_prefix(advance);
+            consumed += advance;
+            scanned = 0;
+
+            context ctx{};
+            auto it = line.data();
+            const auto line_end = line.data() + line.size();
+            detail::skip_ws(ctx, it, line_end);
+            if (!bool(ctx.error) && it == line_end) {
+               continue; // blank line
+            }
+            if (!bool(ctx.error)) {
+               detail::read<json>::op<Opts>(value, ctx, it, line_end);
+            }
+            if (!bool(ctx.error)) {
+               detail::skip_ws(ctx, it, line_end);
+               if (!bool(ctx.error) && it != line_end) {
+                  ctx.error = error_code::syntax_error; // more than one value on a line
+               }
+            }
+            if (bool(ctx.error)) [[unlikely]] {
+               error = {ctx.error, line_start + static_cast<size_t>(it - line.data())};
+               return false;
+            }
+            return true;
+         }
+      }
+
+      // the first malformed record, location is the offset from the start of the input
+      const parse_error& last_error() const noexcept { return error; }
+
+      // iterates the records, every record is the same value overwritten
+      struct iterator final
+      {
+         using iterator_category = std::input_iterator_tag;
+         using value_type = T;
+         using difference_type = std::ptrdiff_t;
+         using pointer = T*;
+         using reference = T&;
+
+         ndjson_reader* reader{};
+         bool done{};
+
+         T& operator*() const noexcept { return reader->value; }
+         T* operator->() const noexcept { return &reader->value; }
+
+         iterator& operator++()
+         {
+            done = !reader->next();
+            return *this;
+         }
+
+         void operator++(int) { ++*this; }
+
+         bool operator==(std::default_sentinel_t) const noexcept { return done; }
+      };
+
+      iterator begin() { return {this, !next()}; }
+      std::default_sentinel_t end() const noexcept { return {}; }
+
+     private:
+      static constexpr size_t block_size = 65536;
+
+      sv data{}; // the unread input
+      size_t scanned{}; // leading bytes of data known to contain no newline
+      size_t consumed{}; // offset of data from the start of the input
+      std::function<size_t(char*, size_t, bool&)> source{};
+      std::string storage{}; // holds blocks read from the source
+      parse_error error{};
+
+      // appends a block from the source after the unread input, returns false once the source is exhausted
+      bool fill()
+      {
+         const auto unread = data.size();
+         if (unread > 0) {
+            std::memmove(storage.data(), data.data(), unread);
+         }
+         scanned = unread;
+         if (storage.size() < unread + block_size) {
+            storage.resize(std::max(2 * storage.size(), unread + block_size));
+         }
+         bool failed = false;
+         const auto n = source(storage.data() + unread, storage.size() - unread, failed);
+         data = sv{storage.data(), unread + n};
+         if (failed) [[unlikely]] {
+            error = {error_code::read_failure, consumed + data.size()};
+         }
+         if (n == 0) {
+            source = {};
+         }
+         return n > 0;
+      }
+   };
+
+   // Appends records to one buffer as newline delimited JSON.
+   // The buffer is grown geometrically and only trimmed when the output is taken, so appends do not reallocate per record.
+   template <opts Opts = opts{}>
+   struct ndjson_writer final
+   {
+      void append(auto&& record)
+      {
+         if (buffer.size() < ix + 32) {
+            buffer.resize(std::max<size_t>(2 * buffer.size(), ix + 32));
+         }
+         detail::write<json>::op<Opts>(record, buffer, ix);
+         detail::dump<'\n'>(buffer, ix);
+      }
+
+      template <class Range>
+      void append_range(Range&& records)
+      {
+         for (auto&& record : records) {
+            append(record);
+         }
+      }
+
+      // the records written so far
+      sv view() const noexcept { return {buffer.data(), ix}; }
+
+      // moves the output out, leaving the writer empty
+      std::string take()
+      {
+         buffer.resize(ix);
+         ix = 0;
+         return std::move(buffer);
+      }
+
+      void clear() noexcept { ix = 0; }
+
+     private:
+      std::string buffer{};
+      size_t ix{}; // the written length, the buffer may be longer
+   };
+
+   template <class Range>
+   inline void write_ndjson(Range&& records, std::string& buffer)
+   {
+      ndjson_writer<> writer{};
+      writer.append_range(records);
+      buffer = writer.take();
+   }
+
+   template <class Range>
+   inline std::string write_ndjson(Range&& records)
+   {
+      std::string buffer{};
+      write_ndjson(records, buffer);
+      return buffer;
+   }
+}
@@ -6,34 +6,79 @@
 #include <iterator>
 #include <ranges>
 #include <charconv>
+#include <cstring>
 
 #include "fast_float/fast_float.h"
 #include "glaze/core/read.hpp"
 #include "glaze/core/format.hpp"
 #include "glaze/util/type_traits.hpp"
 #include "glaze/util/parse.hpp"
+#include "glaze/util/atoi.hpp"
 #include "glaze/util/for_each.hpp"
+#include "glaze/json/json_ptr.hpp"
+#include "glaze/json/structural_index.hpp"
 
 namespace glz
 {
    namespace detail
    {
-      inline void skip_object_value(auto&& it, auto&& end)
+      // opts.minified trusts the input to be glaze's own minified output, so whitespace is not skipped
+      template <auto& Opts>
+      inline void skip_ws(auto&& ctx, auto&& it, auto&& end) noexcept
       {
-         skip_ws(it, end);
+         if constexpr (!Opts.minified) {
+            skip_ws(ctx, it, end);
+         }
+      }
+
+      // opts.minified steps over separators without checking them
+      template <char c, auto& Opts>
+      inline void match(auto&& ctx, auto&& it, auto&& end) noexcept
+      {
+         if constexpr (Opts.minified) {
+            ++it;
+         }
+         else {
+            match<c>(ctx, it, end);
+         }
+      }
+
+      template <auto& Opts>
+      inline void skip_object_value(auto&& ctx, auto&& it, auto&& end)
+      {
+         skip_ws<Opts>(ctx, it, end);
+         if (bool(ctx.error)) [[unlikely]]
+            return;
+         if constexpr (Opts.structural_index && contiguous_iterator<decltype(it)>) {
+            if (it != end && (*it == '{' || *it == '[')) {
+               if (!ctx.index) {
+                  // the remaining buffer is indexed once, on the first skipped container
+                  thread_local structural_index index{};
+                  const auto [b, e] = to_pointers(it, end);
+                  index.build(b, e);
+                  ctx.index = &index;
+               }
+               if (const auto close = ctx.index->find_close(&*it)) {
+                  it += (close - &*it) + 1;
+                  return;
+               }
+            }
+         }
          while (it != end) {
             switch (*it) {
                case '{':
-                  skip_until_closed<'{', '}'>(it, end);
+                  skip_until_closed<'{', '}'>(ctx, it, end);
                   break;
                case '[':
-                  skip_until_closed<'[', ']'>(it, end);
+                  skip_until_closed<'[', ']'>(ctx, it, end);
                   break;
                case '"':
-                  skip_string(it, end);
+                  skip_string(ctx, it, end);
                   break;
                case '/':
-                  skip_comment(it, end);
+                  skip_comment(ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
                   continue;
                case ',':
                case '}':
@@ -52,41 +97,75 @@ namespace glz
       template <class T = void>
       struct from_json {};
       
+      // reads a quoted key as a view into the buffer
+      // returns false without consuming anything if the key contains escapes or control characters, which are left to
+      // the string reader
+      // For buffered input the view is into the current block and is only valid until the iterator next moves, keys
+      // that reach the end of the block are left to the string reader.
+      inline bool read_key_view(auto&& ctx, auto&& it, auto&& end, sv& key) noexcept
+      {
+         const auto [p, e] = scan_window(it, end);
+         if (p == e || *p != '"') [[unlikely]] {
+            ctx.error = error_code::expected_quote;
+            return false;
+         }
+         const auto c = find_string_special(p + 1, e);
+         if constexpr (windowed_iterator<decltype(it)>) {
+            if (c == e || c + 1 == e) {
+               return false;
+            }
+         }
+         else if (c == e) [[unlikely]] {
+            it += e - p;
+            ctx.error = error_code::expected_quote;
+            return false;
+         }
+         if (*c != '"') [[unlikely]] {
+            return false;
+         }
+         key = sv{p + 1, static_cast<size_t>(c - p - 1)};
+         scan_advance(it, static_cast<size_t>((c + 1) - p));
+         return true;
+      }
+      
       template <>
       struct read<json>
       {
-         template <class T, class It0, class It1>
-         static void op(T&& value, It0&& it, It1&& end) {
-            from_json<std::decay_t<T>>::op(std::forward<T>(value), std::forward<It0>(it), std::forward<It1>(end));
+         template <auto& Opts, class T, class Ctx, class It0, class It1>
+         static void op(T&& value, Ctx&& ctx, It0&& it, It1&& end) {
+            from_json<std::decay_t<T>>::template op<Opts>(std::forward<T>(value), std::forward<Ctx>(ctx), std::forward<It0>(it), std::forward<It1>(end));
          }
       };
       
       template <bool_t T>
       struct from_json<T>
       {
-         static void op(bool_t auto&& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(bool_t auto&& value, auto&& ctx, auto&& it, auto&& end) noexcept
          {
-            skip_ws(it, end);
-            if (it < end) [[likely]] {
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            if (it != end) [[likely]] {
                switch (*it) {
                case 't': {
                   ++it;
-                  match<"rue">(it, end);
+                  match<"rue">(ctx, it, end);
                   value = true;
                   break;
                }
                case 'f': {
                   ++it;
-                  match<"alse">(it, end);
+                  match<"alse">(ctx, it, end);
                   value = false;
                   break;
                }
                   [[unlikely]] default
-                     : throw std::runtime_error("Expected true or false");
+                     : ctx.error = error_code::expected_true_or_false;
                }
             }
             else [[unlikely]] {
-               throw std::runtime_error("Expected true or false");
+               ctx.error = error_code::expected_true_or_false;
             }
          }
       };
@@ -94,145 +173,418 @@ namespace glz
       template <num_t T>
       struct from_json<T>
       {
-         template <class It>
-         static void op(auto&& value, It&& it, auto&& end)
+         template <auto& Opts, class It>
+         static void op(auto&& value, auto&& ctx, It&& it, auto&& end) noexcept
          {
-            skip_ws(it, end);
-            if (it == end) [[unlikely]]
-               throw std::runtime_error("Unexpected end of buffer");
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            if (it == end) [[unlikely]] {
+               ctx.error = error_code::unexpected_end;
+               return;
+            }
             
-            if constexpr (std::contiguous_iterator<std::decay_t<It>>)
+            if constexpr (windowed_iterator<It>) {
+               // a number within the current block is parsed in place, one reaching the end of the block is read
+               // through the iterator
+               const auto [p, e] = it.window();
+               auto c = p;
+               while (c != e && is_numeric(*c)) {
+                  ++c;
+               }
+               if (c != p && c != e) {
+                  const char* q = p;
+                  op<Opts>(value, ctx, q, c);
+                  it.advance(static_cast<size_t>(q - p));
+                  return;
+               }
+            }
+            
+            if constexpr (int_t<T>) {
+               read_integer(value, ctx, it, end);
+            }
+            else if constexpr (std::contiguous_iterator<std::decay_t<It>>)
             {
-               if constexpr (std::is_floating_point_v<T>)
-               {
-                  const auto size = std::distance(it, end);
-                  const auto start = &*it;
-                  auto [p, ec] = fast_float::from_chars(start, start + size, value);
-                  if (ec != std::errc{}) [[unlikely]]
-                     throw std::runtime_error("Failed to parse number");
-                  it += (p - &*it);
-               }
-               else
-               {
-                  double temp;
-                  const auto size = std::distance(it, end);
-                  const auto start = &*it;
-                  auto [p, ec] = fast_float::from_chars(start, start + size, temp);
-                  if (ec != std::errc{}) [[unlikely]]
-                     throw std::runtime_error("Failed to parse number");
-                  it += (p - &*it);
-                  value = static_cast<T>(temp);
+               const auto size = std::distance(it, end);
+               const auto start = &*it;
+               auto [p, ec] = fast_float::from_chars(start, start + size, value);
+               if (ec != std::errc{}) [[unlikely]] {
+                  ctx.error = error_code::parse_number_failure;
+                  return;
                }
+               it += (p - &*it);
             }
             else {
                double num;
                char buffer[256];
                size_t i{};
                while (it != end && is_numeric(*it)) {
-                  if (i > 254) [[unlikely]]
-                     throw std::runtime_error("Number is too long");
-                  buffer[i] = *it++;
+                  if (i > 254) [[unlikely]] {
+                     ctx.error = error_code::number_too_long;
+                     return;
+                  }
+                  buffer[i] = *it;
+                  ++it;
                   ++i;
                }
                auto [p, ec] = fast_float::from_chars(buffer, buffer + i, num);
-               if (ec != std::errc{}) [[unlikely]]
-                  throw std::runtime_error("Failed to parse number");
+               if (ec != std::errc{}) [[unlikely]] {
+                  ctx.error = error_code::parse_number_failure;
+                  return;
+               }
                value = static_cast<T>(num);
             }
          }
+         
+         // integers written with a fraction or exponent (e.g. 1e4) are parsed as doubles and truncated
+         static void from_double(auto&& value, auto&& ctx, const char* first, const char* last, const char*& p) noexcept
+         {
+            double temp;
+            const auto [ptr, ec] = fast_float::from_chars(first, last, temp);
+            if (ec != std::errc{} || !in_range<T>(temp)) [[unlikely]] {
+               ctx.error = error_code::parse_number_failure;
+               return;
+            }
+            value = static_cast<T>(temp);
+            p = ptr;
+         }
+         
+         template <class It>
+         static void read_integer(auto&& value, auto&& ctx, It&& it, auto&& end) noexcept
+         {
+            if constexpr (std::contiguous_iterator<std::decay_t<It>>) {
+               const auto [start, e] = to_pointers(it, end);
+               auto p = start;
+               const bool negative = *p == '-';
+               p += negative;
+               const auto digits = p;
+               uint64_t magnitude{};
+               const bool fits = parse_digits(magnitude, p, e);
+               // JSON does not allow leading zeros
+               if (p == digits || (*digits == '0' && p - digits > 1)) [[unlikely]] {
+                  ctx.error = error_code::parse_number_failure;
+                  return;
+               }
+               if (p != e && (*p == '.' || *p == 'e' || *p == 'E')) [[unlikely]] {
+                  from_double(value, ctx, start, e, p);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
+               }
+               else if (!fits || !to_integer(value, magnitude, negative)) [[unlikely]] {
+                  ctx.error = error_code::parse_number_failure;
+                  return;
+               }
+               it += p - start;
+            }
+            else {
+               // input iterators are parsed as they are consumed
+               const bool negative = *it == '-';
+               if (negative) {
+                  ++it;
+               }
+               uint64_t magnitude{};
+               bool fits = true;
+               size_t n{};
+               const bool leading_zero = it != end && *it == '0';
+               for (; it != end && is_digit(*it); ++it, ++n) {
+                  const auto d = static_cast<uint64_t>(*it - '0');
+                  if (magnitude > (std::numeric_limits<uint64_t>::max() - d) / 10) [[unlikely]] {
+                     fits = false;
+                  }
+                  magnitude = magnitude * 10 + d;
+               }
+               if (n == 0 || (leading_zero && n > 1)) [[unlikely]] {
+                  ctx.error = error_code::parse_number_failure;
+                  return;
+               }
+               if (it != end && (*it == '.' || *it == 'e' || *it == 'E')) [[unlikely]] {
+                  if (!fits) [[unlikely]] {
+                     ctx.error = error_code::parse_number_failure;
+                     return;
+                  }
+                  char buffer[256];
+                  buffer[0] = '-';
+                  auto last = std::to_chars(buffer + 1, buffer + 64, magnitude).ptr;
+                  while (it != end && is_numeric(*it)) {
+                     if (last == buffer + 256) [[unlikely]] {
+                        ctx.error = error_code::number_too_long;
+                        return;
+                     }
+                     *last++ = *it;
+                     ++it;
+                  }
+                  const char* first = negative ? buffer : buffer + 1;
+                  const char* p{};
+                  from_double(value, ctx, first, last, p);
+               }
+               else if (!fits || !to_integer(value, magnitude, negative)) [[unlikely]] {
+                  ctx.error = error_code::parse_number_failure;
+               }
+            }
+         }
       };
 
+      // Clean runs between escapes are found with a vector scan and copied in bulk, escapes are decoded to UTF-8 as
+      // they are reached, and raw control characters are rejected.
       template <str_t T>
       struct from_json<T>
       {
-         static void op(auto& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto& value, auto&& ctx, auto&& it, auto&& end)
          {
-            // TODO: this does not handle control chars like \t and \n
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            match<'"'>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
             
-            skip_ws(it, end);
-            match<'"'>(it, end);
-            const auto cend = value.cend();
-            for (auto c = value.begin(); c < cend; ++c, ++it)
-            {
-               if (it == end) [[unlikely]]
-                  throw std::runtime_error("Expected \"");
-               switch (*it) {
-                  [[unlikely]] case '\\':
-                  {
-                     if (++it == end) [[unlikely]]
-                        throw std::runtime_error("Expected \"");
-                     else [[likely]] {
-                        *c = *it;
-                     }
+            value.clear();
+            char utf8[4];
+            if constexpr (contiguous_iterator<decltype(it)>) {
+               const auto [start, e] = to_pointers(it, end);
+               auto p = start;
+               while (true) {
+                  const auto c = find_string_special(p, e);
+                  if (c == e) [[unlikely]] {
+                     it += e - start;
+                     ctx.error = error_code::expected_quote;
+                     return;
+                  }
+                  value.append(p, static_cast<size_t>(c - p));
+                  if (*c == '"') {
+                     p = c + 1;
                      break;
                   }
-                  [[unlikely]] case '"':
-                  {
-                     ++it;
-                     value.resize(std::distance(value.begin(), c));
+                  else if (*c != '\\') [[unlikely]] {
+                     it += c - start;
+                     ctx.error = error_code::unescaped_control_character;
                      return;
                   }
-                  [[likely]] default : *c = *it;
+                  p = c + 1;
+                  const auto code_point = read_escape(ctx, p, e);
+                  if (bool(ctx.error)) [[unlikely]] {
+                     it += p - start;
+                     return;
+                  }
+                  value.append(utf8, to_utf8(code_point, utf8));
                }
+               it += p - start;
+               return;
+            }
+            else if constexpr (windowed_iterator<decltype(it)>) {
+               // escapes may straddle blocks, so they are decoded through the iterator
+               while (it != end) {
+                  const auto [p, e] = it.window();
+                  const auto c = find_string_special(p, e);
+                  value.append(p, static_cast<size_t>(c - p));
+                  if (c == e) {
+                     it.advance(static_cast<size_t>(e - p));
+                  }
+                  else if (*c == '"') {
+                     it.advance(static_cast<size_t>(c - p) + 1);
+                     return;
+                  }
+                  else if (*c != '\\') [[unlikely]] {
+                     it.advance(static_cast<size_t>(c - p));
+                     ctx.error = error_code::unescaped_control_character;
+                     return;
+                  }
+                  else {
+                     it.advance(static_cast<size_t>(c - p) + 1);
+                     const auto code_point = read_escape(ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     value.append(utf8, to_utf8(code_point, utf8));
+                  }
+               }
+               ctx.error = error_code::expected_quote;
+               return;
             }
             
-            while (it < end) {
-               switch (*it) {
-                  [[unlikely]] case '\\':
-                  {
-                     if (++it == end) [[unlikely]]
-                        throw std::runtime_error("Expected \"");
-                     else [[likely]] {
-                        value.push_back(*it);
-                     }
-                     break;
+            while (it != end) {
+               const auto c = *it;
+               if (c == '"') {
+                  ++it;
+                  return;
+               }
+               else if (c == '\\') {
+                  ++it;
+                  const auto code_point = read_escape(ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
+                  value.append(utf8, to_utf8(code_point, utf8));
+               }
+               else if (static_cast<uint8_t>(c) < 0x20) [[unlikely]] {
+                  ctx.error = error_code::unescaped_control_character;
+                  return;
+               }
+               else {
+                  value.push_back(c);
+                  ++it;
+               }
+            }
+            ctx.error = error_code::expected_quote;
+         }
+      };
+      
+      // views the string in the input buffer instead of copying it
+      // escaped strings are decoded in place, which requires a mutable buffer
+      template <>
+      struct from_json<std::string_view>
+      {
+         template <auto& Opts>
+         static void op(std::string_view& value, auto&& ctx, auto&& it, auto&& end)
+         {
+            static_assert(contiguous_iterator<decltype(it)>,
+                          "std::string_view requires a contiguous buffer, use std::string");
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            match<'"'>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+
+            const auto [start, e] = to_pointers(it, end);
+            auto p = find_string_special(start, e);
+            if (p == e) [[unlikely]] {
+               it += e - start;
+               ctx.error = error_code::expected_quote;
+               return;
+            }
+            else if (*p == '"') [[likely]] {
+               value = sv{start, static_cast<size_t>(p - start)};
+               it += (p + 1) - start;
+               return;
+            }
+            else if (*p != '\\') [[unlikely]] {
+               it += p - start;
+               ctx.error = error_code::unescaped_control_character;
+               return;
+            }
+
+            if constexpr (std::is_const_v<std::remove_reference_t<decltype(*it)>>) {
+               it += p - start;
+               ctx.error = error_code::escaped_string_view;
+            }
+            else {
+               // every escape is at least as long as its UTF-8, so the decoded string is written over the escaped one
+               char* w = &*it + (p - start);
+               while (true) {
+                  ++p;
+                  const auto code_point = read_escape(ctx, p, e);
+                  if (bool(ctx.error)) [[unlikely]] {
+                     it += p - start;
+                     return;
                   }
-                  [[unlikely]] case '"':
-                  {
-                     ++it;
+                  w += to_utf8(code_point, w);
+                  const auto c = find_string_special(p, e);
+                  if (c == e) [[unlikely]] {
+                     it += e - start;
+                     ctx.error = error_code::expected_quote;
+                     return;
+                  }
+                  const auto n = static_cast<size_t>(c - p);
+                  std::memmove(w, p, n);
+                  w += n;
+                  p = c;
+                  if (*p == '"') {
+                     // the closing quote moves up to the decoded string and the bytes it frees become whitespace,
+                     // so the buffer does not keep a stale tail of the escaped string
+                     value = sv{start, static_cast<size_t>(w - start)};
+                     *w = '"';
+                     std::memset(w + 1, ' ', static_cast<size_t>(p - w));
+                     it += (p + 1) - start;
+                     return;
+                  }
+                  else if (*p != '\\') [[unlikely]] {
+                     it += p - start;
+                     ctx.error = error_code::unescaped_control_character;
                      return;
                   }
-                  [[likely]] default : value.push_back(*it);
                }
-               ++it;
             }
-            throw std::runtime_error("Expected \"");
          }
       };
       
       template <char_t T>
       struct from_json<T>
       {
-         static void op(auto& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto& value, auto&& ctx, auto&& it, auto&& end) noexcept
          {
-            // TODO: this does not handle escaped chars
-            match<'"'>(it, end);
-            if (it == end) [[unlikely]]
-               throw std::runtime_error("Unxpected end of buffer");
-            if (*it == '\\') [[unlikely]]
-               if (++it == end) [[unlikely]]
-                  throw std::runtime_error("Unxpected end of buffer");
-            value = *it++;
-            match<'"'>(it, end);
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            match<'"'>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            if (it == end) [[unlikely]] {
+               ctx.error = error_code::unexpected_end;
+               return;
+            }
+            const auto c = *it;
+            if (c == '\\') {
+               ++it;
+               const auto code_point = read_escape(ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+               // escapes that do not fit in one character of T are not decoded into several
+               constexpr uint32_t max = sizeof(T) == 1 ? 0x7F : sizeof(T) == 2 ? 0xFFFF : 0x10FFFF;
+               if (code_point > max) [[unlikely]] {
+                  ctx.error = error_code::invalid_escape;
+                  return;
+               }
+               value = static_cast<T>(code_point);
+            }
+            else if (static_cast<uint8_t>(c) < 0x20) [[unlikely]] {
+               ctx.error = error_code::unescaped_control_character;
+               return;
+            }
+            else {
+               value = static_cast<T>(c);
+               ++it;
+            }
+            match<'"'>(ctx, it, end);
          }
       };
 
+      // names are matched with the key hash of the enum (see find_key), straight from the buffer when it is contiguous
       template <glaze_enum_t T>
       struct from_json<T>
       {
-         static void op(auto& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto& value, auto&& ctx, auto&& it, auto&& end)
          {
-            //Could do better key parsing for enums since we know we cant have escapes and we know the max size
-            static thread_local std::string key{};
-            read<json>::op(key, it, end);
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            [[maybe_unused]] const auto start = it;
+            sv name{};
+            bool viewed = false;
+            if constexpr (contiguous_iterator<decltype(it)> || windowed_iterator<decltype(it)>) {
+               viewed = read_key_view(ctx, it, end, name);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+            }
+            if (!viewed) {
+               static thread_local std::string buffer{};
+               read<json>::op<Opts>(buffer, ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+               name = buffer;
+            }
 
-            static constexpr auto frozen_map = detail::make_string_to_enum_map<T>();
-            const auto& member_it = frozen_map.find(frozen::string(key));
-            if (member_it != frozen_map.end()) {
-               value = member_it->second;
+            static constexpr auto values = make_enum_value_array<T>();
+            const auto index = find_key<T>(name);
+            if (index < values.size()) [[likely]] {
+               value = values[index];
             }
             else [[unlikely]] {
-               throw std::runtime_error("Enexpected enum value '" + key + "'");
+               ctx.error = error_code::unexpected_enum;
+               if constexpr (std::forward_iterator<std::decay_t<decltype(it)>>) {
+                  it = start; // the error location points at the unknown name, so format_error shows it
+               }
             }
          }
       };
@@ -240,21 +592,77 @@ namespace glz
       template <func_t T>
       struct from_json<T>
       {
-         static void op(auto& /*value*/, auto&& /*it*/, auto&& /*end*/)
+         template <auto& Opts>
+         static void op(auto& /*value*/, auto&& /*ctx*/, auto&& /*it*/, auto&& /*end*/)
+         {
+         }
+      };
+      
+      // forwards to an input iterator, appending every character it steps over
+      template <class It>
+      struct capture_iterator final
+      {
+         It& it;
+         std::string& out;
+
+         decltype(auto) operator*() const { return *it; }
+
+         capture_iterator& operator++()
+         {
+            out.push_back(*it);
+            ++it;
+            return *this;
+         }
+
+         template <class End>
+         bool operator==(const End& end) const
          {
+            return it == end;
          }
       };
       
       template <>
       struct from_json<raw_json>
       {
-         static void op(raw_json& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(raw_json& value, auto&& ctx, auto&& it, auto&& end)
          {
-            // TODO this will not work for streams where we cant move backward
-            auto it_start = it;
-            skip_object_value(it, end);
-            value.str.clear();
-            value.str.insert(value.str.begin(), it_start, it);
+            if constexpr (std::forward_iterator<std::decay_t<decltype(it)>>) {
+               auto it_start = it;
+               skip_object_value<Opts>(ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+               value.str.clear();
+               value.str.insert(value.str.begin(), it_start, it);
+            }
+            else {
+               // input iterators cannot move backward, so the value is recorded as it is skipped
+               value.str.clear();
+               capture_iterator<std::decay_t<decltype(it)>> capture{it, value.str};
+               skip_object_value<Opts>(ctx, capture, end);
+            }
+         }
+      };
+
+      template <>
+      struct from_json<raw_json_view>
+      {
+         template <auto& Opts>
+         static void op(raw_json_view& value, auto&& ctx, auto&& it, auto&& end)
+         {
+            static_assert(contiguous_iterator<decltype(it)>, "raw_json_view requires a contiguous buffer, use raw_json");
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            if (it == end) [[unlikely]] {
+               ctx.error = error_code::unexpected_end;
+               return;
+            }
+            const auto it_start = it;
+            skip_object_value<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            value.str = sv{&*it_start, static_cast<size_t>(it - it_start)};
          }
       };
 
@@ -263,35 +671,49 @@ namespace glz
        !resizeable<T>)
       struct from_json<T>
       {
-         static void op(auto& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto& value, auto&& ctx, auto&& it, auto&& end)
          {
-            skip_ws(it, end);
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
             auto value_it = value.begin();
-            match<'['>(it, end);
-            skip_ws(it, end);
-            for (size_t i = 0; it < end; ++i) {
+            match<'['>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            for (size_t i = 0; Opts.minified || it != end; ++i) {
                if (*it == ']') [[unlikely]] {
                   ++it;
                   if constexpr (resizeable<T>) value.resize(i);
                   return;
                }
                if (i > 0) [[likely]] {
-                  match<','>(it, end);
+                  match<',', Opts>(ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
                }
                if (i < static_cast<size_t>(value.size())) {
-                  read<json>::op(*value_it++, it, end);
+                  read<json>::op<Opts>(*value_it++, ctx, it, end);
                }
                else {
                   if constexpr (emplace_backable<T>) {
-                     read<json>::op(value.emplace_back(), it, end);
+                     read<json>::op<Opts>(value.emplace_back(), ctx, it, end);
                   }
                   else {
-                     throw std::runtime_error("Exceeded static array size.");
+                     ctx.error = error_code::exceeded_static_array_size;
+                     return;
                   }
                }
-               skip_ws(it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+               skip_ws<Opts>(ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
             }
-            throw std::runtime_error("Expected ]");
+            ctx.error = error_code::expected_end_bracket;
          }
       };
       
@@ -300,16 +722,23 @@ namespace glz
        resizeable<T>)
       struct from_json<T>
       {
-         static void op(auto& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto& value, auto&& ctx, auto&& it, auto&& end)
          {
             using value_t = nano::ranges::range_value_t<T>;
             static thread_local std::vector<value_t> buffer{};
             buffer.clear();
 
-            skip_ws(it, end);
-            match<'['>(it, end);
-            skip_ws(it, end);
-            for (size_t i = 0; it < end; ++i) {
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            match<'['>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            for (size_t i = 0; Opts.minified || it != end; ++i) {
                if (*it == ']') [[unlikely]] {
                   ++it;
                   value.resize(i);
@@ -320,19 +749,26 @@ namespace glz
                   return;
                }
                if (i > 0) [[likely]] {
-                  match<','>(it, end);
+                  match<',', Opts>(ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
                }
-               read<json>::op(buffer.emplace_back(), it, end);
-               skip_ws(it, end);
+               read<json>::op<Opts>(buffer.emplace_back(), ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+               skip_ws<Opts>(ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
             }
-            throw std::runtime_error("Expected ]");
+            ctx.error = error_code::expected_end_bracket;
          }
       };
 
       template <class T> requires glaze_array_t<T> || tuple_t<T>
       struct from_json<T>
       {
-         static void op(auto& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto& value, auto&& ctx, auto&& it, auto&& end)
          {
             static constexpr auto N = []() constexpr
             {
@@ -345,41 +781,123 @@ namespace glz
             }
             ();
             
-            skip_ws(it, end);
-            match<'['>(it, end);
-            skip_ws(it, end);
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            match<'['>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
             
             for_each<N>([&](auto I) {
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
                if constexpr (I != 0) {
-                  match<','>(it, end);
+                  match<',', Opts>(ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
                }
                if constexpr (glaze_array_t<T>) {
-                  read<json>::op(value.*std::get<I>(meta_v<T>), it, end);
+                  read<json>::op<Opts>(value.*std::get<I>(meta_v<T>), ctx, it, end);
                }
                else {
-                  read<json>::op(std::get<I>(value), it, end);
+                  read<json>::op<Opts>(std::get<I>(value), ctx, it, end);
                }
-               skip_ws(it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+               skip_ws<Opts>(ctx, it, end);
             });
+            if (bool(ctx.error)) [[unlikely]]
+               return;
             
             if constexpr (N == 0) {
-               skip_ws(it, end);
+               skip_ws<Opts>(ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
             }
-            match<']'>(it, end);
+            match<']'>(ctx, it, end);
          }
       };
       
+      template <class T>
+      concept heterogeneous_map = requires
+      {
+         typename T::key_compare::is_transparent;
+      } || requires
+      {
+         typename T::hasher::is_transparent;
+         typename T::key_equal::is_transparent;
+      };
+      
+      template <class T>
+      concept ordered_map = requires(T& map)
+      {
+         typename T::key_compare;
+         map.key_comp();
+      };
+      
+      // the mapped value for a key, inserting a default one if it is missing, without building a key string for hits
+      // keys and values are constructed in place, so maps with polymorphic allocators give them the map's resource
+      template <class T>
+      inline auto& map_slot(T& map, const sv key)
+      {
+         if constexpr (heterogeneous_map<T>) {
+            if constexpr (ordered_map<T>) {
+               auto hint = map.lower_bound(key);
+               if (hint != map.end() && !map.key_comp()(key, hint->first)) {
+                  return hint->second;
+               }
+               return map.emplace_hint(hint, std::piecewise_construct, std::forward_as_tuple(key), std::tuple{})->second;
+            }
+            else {
+               auto found = map.find(key);
+               if (found != map.end()) {
+                  return found->second;
+               }
+               return map.emplace(std::piecewise_construct, std::forward_as_tuple(key), std::tuple{}).first->second;
+            }
+         }
+         else {
+            static thread_local typename T::key_type k{};
+            k.assign(key.data(), key.size());
+            if constexpr (ordered_map<T>) {
+               // sorted input (as glaze writes ordered maps) appends at the end without a tree search
+               if (map.empty() || map.key_comp()(std::prev(map.end())->first, k)) {
+                  return map.emplace_hint(map.end(), std::piecewise_construct, std::forward_as_tuple(k), std::tuple{})->second;
+               }
+            }
+            return map[k];
+         }
+      }
+      
       template <class T>
       requires map_t<T> || glaze_object_t<T>
       struct from_json<T>
       {
-         static void op(auto& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto& value, auto&& ctx, auto&& it, auto&& end)
          {
-            skip_ws(it, end);
-            match<'{'>(it, end);
-            skip_ws(it, end);
-            bool first = true;
-            while (it < end) {
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            match<'{'>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            read_members<Opts>(value, ctx, it, end, true);
+         }
+
+         // reads the members up to and including the closing brace
+         // first is false when members have already been read, so the input continues with a comma or the brace
+         template <auto& Opts>
+         static void read_members(auto& value, auto&& ctx, auto&& it, auto&& end, bool first)
+         {
+            [[maybe_unused]] size_t expected = 0; // declaration order index of the next key
+            while (Opts.minified || it != end) {
                if (*it == '}') [[unlikely]] {
                   ++it;
                   return;
@@ -387,61 +905,173 @@ namespace glz
                else if (first) [[unlikely]]
                   first = false;
                else [[likely]] {
-                  match<','>(it, end);
+                  match<',', Opts>(ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
                }
-               static thread_local std::string key{};
-               read<json>::op(key, it, end);
-               skip_ws(it, end);
-               match<':'>(it, end);
                if constexpr (glaze_object_t<T>) {
-                  static constexpr auto frozen_map = detail::make_map<T>();
-                  const auto& member_it = frozen_map.find(frozen::string(key));
-                  if (member_it != frozen_map.end()) {
-                     std::visit(
-                        [&](auto&& member_ptr) {
-                           using V = std::decay_t<decltype(member_ptr)>;
-                           if constexpr (std::is_member_pointer_v<V>) {
-                              read<json>::op(value.*member_ptr, it, end);
-                           }
-                           else {
-                              read<json>::op(member_ptr(value), it, end);
-                           }
-                        },
-                        member_it->second);
+                  static constexpr auto N = std::tuple_size_v<meta_t<T>>;
+                  size_t index = N;
+                  skip_ws<Opts>(ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
+                  if constexpr (contiguous_iterator<decltype(it)> || windowed_iterator<decltype(it)>) {
+                     // glaze writes keys in declaration order, so try the next expected key before hashing
+                     static constexpr auto keys = make_key_array<T>();
+                     if (expected < N) {
+                        const auto key = keys[expected];
+                        const auto n = key.size();
+                        const auto [p, e] = scan_window(it, end);
+                        if (static_cast<size_t>(e - p) > n + 1 && p[0] == '"' && p[n + 1] == '"' &&
+                            std::memcmp(p + 1, key.data(), n) == 0) {
+                           scan_advance(it, n + 2);
+                           index = expected;
+                        }
+                     }
+                  }
+                  if (index == N) {
+                     sv key{};
+                     bool viewed = false;
+                     if constexpr (contiguous_iterator<decltype(it)> || windowed_iterator<decltype(it)>) {
+                        viewed = read_key_view(ctx, it, end, key);
+                        if (bool(ctx.error)) [[unlikely]]
+                           return;
+                     }
+                     if (!viewed) {
+                        static thread_local std::string buffer{};
+                        read<json>::op<Opts>(buffer, ctx, it, end);
+                        if (bool(ctx.error)) [[unlikely]]
+                           return;
+                        key = buffer;
+                     }
+                     index = find_key<T>(key);
+                  }
+                  skip_ws<Opts>(ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
+                  match<':', Opts>(ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
+                  if (index < N) [[likely]] {
+                     visit_member<T>(value, index,
+                                     [&](auto&& member) { read<json>::op<Opts>(member, ctx, it, end); });
+                     expected = index + 1;
                   }
                   else [[unlikely]] {
-                     skip_object_value(it, end);
+                     skip_object_value<Opts>(ctx, it, end);
                   }
                }
                else {
-                  if constexpr (std::is_same_v<typename T::key_type,
-                                               std::string>) {
-                     read<json>::op(value[key], it, end);
+                  using K = typename T::key_type;
+                  if constexpr (num_t<K>) {
+                     // numeric keys are parsed straight from between the quotes
+                     skip_ws<Opts>(ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     match<'"'>(ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     K key_value{};
+                     read<json>::op<Opts>(key_value, ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     match<'"'>(ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     skip_ws<Opts>(ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     match<':', Opts>(ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     read<json>::op<Opts>(value[key_value], ctx, it, end);
+                  }
+                  else if constexpr (std::is_same_v<K, std::string> || std::is_same_v<K, std::pmr::string>) {
+                     sv key{};
+                     bool viewed = false;
+                     if constexpr (contiguous_iterator<decltype(it)>) {
+                        skip_ws<Opts>(ctx, it, end);
+                        if (bool(ctx.error)) [[unlikely]]
+                           return;
+                        viewed = read_key_view(ctx, it, end, key);
+                        if (bool(ctx.error)) [[unlikely]]
+                           return;
+                     }
+                     if (!viewed) {
+                        static thread_local std::string buffer{};
+                        read<json>::op<Opts>(buffer, ctx, it, end);
+                        if (bool(ctx.error)) [[unlikely]]
+                           return;
+                        key = buffer;
+                     }
+                     skip_ws<Opts>(ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     match<':', Opts>(ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     read<json>::op<Opts>(map_slot(value, key), ctx, it, end);
+                  }
+                  else if constexpr (std::is_same_v<K, std::string_view>) {
+                     // keys view the input buffer, see from_json<std::string_view>
+                     K key{};
+                     read<json>::op<Opts>(key, ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     skip_ws<Opts>(ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     match<':', Opts>(ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     read<json>::op<Opts>(value[key], ctx, it, end);
                   }
                   else {
-                     static thread_local typename T::key_type key_value{};
-                     read<json>::op(key_value, key.begin(), key.end());
-                     read<json>::op(value[key_value], it, end);
+                     static thread_local std::string key{};
+                     read<json>::op<Opts>(key, ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     skip_ws<Opts>(ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     match<':', Opts>(ctx, it, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     static thread_local K key_value{};
+                     read<json>::op<Opts>(key_value, ctx, key.begin(), key.end());
+                     if (bool(ctx.error)) [[unlikely]]
+                        return;
+                     read<json>::op<Opts>(value[key_value], ctx, it, end);
                   }
                }
-               skip_ws(it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+               skip_ws<Opts>(ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
             }
-            throw std::runtime_error("Expected }");
+            ctx.error = error_code::expected_end_brace;
          }
       };
       
       template <nullable_t T>
       struct from_json<T>
       {
-         static void op(auto& value, auto&& it, auto&& end)
+         template <auto& Opts>
+         static void op(auto& value, auto&& ctx, auto&& it, auto&& end)
          {
-            skip_ws(it, end);
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
             if (it == end) {
-               throw std::runtime_error("Unexexpected eof");
+               ctx.error = error_code::unexpected_end;
+               return;
             }
             if (*it == 'n') {
                ++it;
-               match<"ull">(it, end);
+               match<"ull">(ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
                if constexpr (!std::is_pointer_v<T>) {
                   value.reset();
                }
@@ -450,19 +1080,413 @@ namespace glz
                if (!value) {
                   if constexpr (is_specialization_v<T, std::optional>)
                      value = std::make_optional<typename T::value_type>();
+                  else if constexpr (requires {
+                                        requires std::same_as<typename T::deleter_type,
+                                                              pmr_deleter<typename T::element_type>>;
+                                     }) {
+                     using E = typename T::element_type;
+                     auto resource = ctx.resource ? ctx.resource : std::pmr::get_default_resource();
+                     auto ptr = static_cast<E*>(resource->allocate(sizeof(E), alignof(E)));
+                     std::uninitialized_construct_using_allocator(ptr, std::pmr::polymorphic_allocator<E>{resource});
+                     value = T{ptr, pmr_deleter<E>{resource}};
+                  }
                   else if constexpr (is_specialization_v<T, std::unique_ptr>)
                      value = std::make_unique<typename T::element_type>();
-                  else if constexpr (is_specialization_v<T, std::shared_ptr>)
-                     value = std::make_shared<typename T::element_type>();
-                  else
-                     throw std::runtime_error(
-                        "Cannot read into unset nullable that is not "
-                        "std::optional, std::unique_ptr, or std::shared_ptr");
+                  else if constexpr (is_specialization_v<T, std::shared_ptr>) {
+                     using E = typename T::element_type;
+                     if (ctx.resource) {
+                        value = std::allocate_shared<E>(std::pmr::polymorphic_allocator<E>{ctx.resource});
+                     }
+                     else {
+                        value = std::make_shared<E>();
+                     }
+                  }
+                  else {
+                     ctx.error = error_code::invalid_nullable_read;
+                     return;
+                  }
+               }
+               read<json>::op<Opts>(*value, ctx, it, end);
+            }
+         }
+      };
+      
+      template <>
+      struct from_json<std::monostate>
+      {
+         template <auto& Opts>
+         static void op(auto&& /*value*/, auto&& ctx, auto&& it, auto&& end) noexcept
+         {
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            match<"null">(ctx, it, end);
+         }
+      };
+
+      // the first alternative of a variant that each kind of JSON value reads into, or N if there is none
+      template <is_variant T>
+      struct variant_deduction final
+      {
+         static constexpr auto N = std::variant_size_v<T>;
+
+         static constexpr size_t first(auto&& pred)
+         {
+            size_t index = N;
+            for_each<N>([&](auto I) {
+               if (index == N && pred(std::type_identity<std::variant_alternative_t<I, T>>{})) {
+                  index = I;
+               }
+            });
+            return index;
+         }
+
+         static constexpr auto object = first([]<class V>(std::type_identity<V>) { return glaze_object_t<V> || map_t<V>; });
+         static constexpr auto map = first([]<class V>(std::type_identity<V>) { return map_t<V>; });
+         static constexpr auto array =
+            first([]<class V>(std::type_identity<V>) { return array_t<V> || glaze_array_t<V> || tuple_t<V>; });
+         static constexpr auto string =
+            first([]<class V>(std::type_identity<V>) { return str_t<V> || char_t<V> || glaze_enum_t<V>; });
+         static constexpr auto boolean = first([]<class V>(std::type_identity<V>) { return bool_t<V>; });
+         static constexpr auto null =
+            first([]<class V>(std::type_identity<V>) { return std::same_as<V, std::monostate> || nullable_t<V>; });
+         static constexpr auto integer = first([]<class V>(std::type_identity<V>) { return int_t<V>; });
+         static constexpr auto floating = first([]<class V>(std::type_identity<V>) { return std::floating_point<V>; });
+      };
+
+      // A variant is read without an intermediate parse.
+      // With a tag (see tag_v) an object or map names its alternative in the tag member. When the tag is the first
+      // member, as glaze writes it, the alternative is chosen there and the remaining members are read straight into it;
+      // otherwise the object is scanned for the tag and then read from its start, and a map alternative drops the tag.
+      // An object without the tag, or whose tag names no alternative, reads into the first map alternative if there is
+      // one. Without a tag, and for values that are not objects, the first character selects the first alternative that
+      // can hold that kind of value.
+      template <is_variant T>
+      struct from_json<T>
+      {
+         static constexpr auto N = std::variant_size_v<T>;
+
+         template <auto& Opts>
+         static void op(auto& value, auto&& ctx, auto&& it, auto&& end)
+         {
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            if (it == end) [[unlikely]] {
+               ctx.error = error_code::unexpected_end;
+               return;
+            }
+
+            using D = variant_deduction<T>;
+            size_t index = N;
+            switch (*it) {
+            case '{':
+               if constexpr (!tag_v<T>.empty()) {
+                  read_tagged<Opts>(value, ctx, it, end);
+                  return;
+               }
+               index = D::object;
+               break;
+            case '[':
+               index = D::array;
+               break;
+            case '"':
+               index = D::string;
+               break;
+            case 't':
+            case 'f':
+               index = D::boolean;
+               break;
+            case 'n':
+               index = D::null;
+               break;
+            default:
+               if (*it != '-' && !(*it >= '0' && *it <= '9')) [[unlikely]] {
+                  break;
+               }
+               if constexpr (D::integer < N && D::floating < N) {
+                  index = integer_literal(it, end) ? D::integer : D::floating;
+               }
+               else {
+                  index = std::min(D::integer, D::floating);
+               }
+            }
+            if (index == N) [[unlikely]] {
+               ctx.error = error_code::no_matching_variant_type;
+               return;
+            }
+            emplace_runtime_variant(value, index);
+            std::visit([&](auto& v) { read<json>::op<Opts>(v, ctx, it, end); }, value);
+         }
+
+         // whether the number at it has no fraction or exponent, input iterators cannot look ahead and read floats
+         static bool integer_literal(auto&& it, auto&& end)
+         {
+            if constexpr (std::forward_iterator<std::decay_t<decltype(it)>>) {
+               for (auto p = it; p != end; ++p) {
+                  const auto c = *p;
+                  if (c == '.' || c == 'e' || c == 'E') {
+                     return false;
+                  }
+                  if (c != '-' && c != '+' && !(c >= '0' && c <= '9')) {
+                     break;
+                  }
+               }
+               return true;
+            }
+            else {
+               return false;
+            }
+         }
+
+         template <auto& Opts>
+         static void read_tagged(auto& value, auto&& ctx, auto&& it, auto&& end)
+         {
+            using It = std::decay_t<decltype(it)>;
+            if constexpr (!std::forward_iterator<It>) {
+               // input iterators cannot be rewound, so the object is captured before it is dispatched
+               std::string buffer{};
+               capture_iterator<It> capture{it, buffer};
+               skip_object_value<Opts>(ctx, capture, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+               const char* b = buffer.data();
+               const char* e = buffer.data() + buffer.size();
+               read_tagged<Opts>(value, ctx, b, e);
+            }
+            else {
+               using D = variant_deduction<T>;
+               static constexpr auto tag = tag_v<T>;
+               static constexpr auto ids = ids_v<T>;
+               static thread_local std::string buffer{};
+               const auto read_string = [&](auto& p) -> sv {
+                  if constexpr (contiguous_iterator<It>) {
+                     sv str{};
+                     if (read_key_view(ctx, p, end, str) || bool(ctx.error)) {
+                        return str;
+                     }
+                  }
+                  read<json>::op<Opts>(buffer, ctx, p, end);
+                  return buffer;
+               };
+
+               auto p = it;
+               ++p;
+               size_t index = N;
+               bool first = true;
+               bool named = false; // the tag named the alternative
+               bool tag_first = false; // and was the first member
+               while (true) {
+                  skip_ws<Opts>(ctx, p, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     break;
+                  if (p == end || *p == '}') [[unlikely]] {
+                     if constexpr (D::map < N) {
+                        if (p != end) {
+                           index = D::map;
+                           break;
+                        }
+                     }
+                     ctx.error = error_code::no_matching_variant_type;
+                     break;
+                  }
+                  if (!first) {
+                     match<',', Opts>(ctx, p, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        break;
+                     skip_ws<Opts>(ctx, p, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        break;
+                  }
+                  const auto key = read_string(p);
+                  if (bool(ctx.error)) [[unlikely]]
+                     break;
+                  const bool is_tag = key == tag;
+                  skip_ws<Opts>(ctx, p, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     break;
+                  match<':', Opts>(ctx, p, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     break;
+                  if (is_tag) {
+                     skip_ws<Opts>(ctx, p, end);
+                     if (bool(ctx.error)) [[unlikely]]
+                        break;
+                     const auto id = read_string(p);
+                     if (bool(ctx.error)) [[unlikely]]
+                        break;
+                     index = std::distance(ids.begin(), std::find(ids.begin(), ids.end(), id));
+                     named = index < N;
+                     tag_first = named && first;
+                     if (index == N) [[unlikely]] {
+                        if constexpr (D::map < N) {
+                           index = D::map; // a map member that uses the key of the tag
+                        }
+                        else {
+                           ctx.error = error_code::no_matching_variant_type;
+                        }
+                     }
+                     break;
+                  }
+                  skip_object_value<Opts>(ctx, p, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     break;
+                  first = false;
+               }
+               if (bool(ctx.error)) [[unlikely]] {
+                  it = p;
+                  return;
                }
-               read<json>::op(*value, it, end);
+
+               emplace_runtime_variant(value, index);
+               std::visit(
+                  [&](auto& v) {
+                     using V = std::decay_t<decltype(v)>;
+                     if constexpr (glaze_object_t<V> || map_t<V>) {
+                        if (tag_first) {
+                           // the rest of the object belongs to the alternative
+                           it = p;
+                           skip_ws<Opts>(ctx, it, end);
+                           if (bool(ctx.error)) [[unlikely]]
+                              return;
+                           from_json<V>::template read_members<Opts>(v, ctx, it, end, false);
+                           return;
+                        }
+                     }
+                     // objects skip the tag as an unknown member
+                     read<json>::op<Opts>(v, ctx, it, end);
+                     if constexpr (map_t<V> && requires { v.erase(typename V::key_type{tag}); }) {
+                        if (named && !bool(ctx.error)) {
+                           v.erase(typename V::key_type{tag}); // the tag came later and was read as a pair
+                        }
+                     }
+                  },
+                  value);
             }
          }
       };
+      
+      // Reads only the values at a set of JSON pointers and skips everything else.
+      // When last is set nothing after the requested values has to be consumed, so reading stops as soon as the final
+      // one has been read instead of scanning the rest of the document.
+      template <auto& Partial, auto& Opts>
+      inline void read_partial(auto& value, auto&& ctx, auto&& it, auto&& end, const bool last)
+      {
+         using T = std::decay_t<decltype(value)>;
+         static constexpr auto partial = Partial;  // MSVC 16.11 hack
+
+         if constexpr (nano::ranges::count(partial, "") > 0) {
+            read<json>::op<Opts>(value, ctx, it, end);
+         }
+         else {
+            static_assert(glaze_object_t<T> || map_t<T>, "Only object types are supported for partial.");
+            static constexpr auto sorted = sort_json_ptrs(partial);
+            static constexpr auto groups = glz::group_json_ptrs<sorted>();
+            static constexpr auto N = std::tuple_size_v<std::decay_t<decltype(groups)>>;
+
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            match<'{'>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+            skip_ws<Opts>(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+
+            std::array<bool, N> found{};
+            size_t remaining = N;
+            bool first = true;
+            while (it != end) {
+               if (*it == '}') [[unlikely]] {
+                  ++it;
+                  return;
+               }
+               else if (first) [[unlikely]]
+                  first = false;
+               else [[likely]] {
+                  match<',', Opts>(ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
+                  skip_ws<Opts>(ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
+               }
+
+               sv key{};
+               bool viewed = false;
+               if constexpr (contiguous_iterator<decltype(it)>) {
+                  viewed = read_key_view(ctx, it, end, key);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
+               }
+               if (!viewed) {
+                  static thread_local std::string buffer{};
+                  read<json>::op<Opts>(buffer, ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
+                  key = buffer;
+               }
+               skip_ws<Opts>(ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+               match<':', Opts>(ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+
+               bool matched = false;
+               glz::for_each<N>([&](auto I) {
+                  static constexpr auto group = []() {
+                     return std::get<decltype(I)::value>(groups);
+                  }();  // MSVC internal compiler error workaround
+                  static constexpr auto key_value = std::get<0>(group);
+                  static constexpr auto sub_partial = std::get<1>(group);
+                  if (matched || key != key_value) {
+                     return;
+                  }
+                  matched = true;
+                  const bool final_value = last && remaining == 1 && !found[I];
+
+                  if constexpr (glaze_object_t<T>) {
+                     static constexpr auto frozen_map = make_map<T>();
+                     static constexpr auto member_it = frozen_map.find(key_value);
+                     static_assert(member_it != frozen_map.end(), "Invalid key passed to partial read");
+                     static constexpr auto member_ptr = std::get<member_it->second.index()>(member_it->second);
+                     if constexpr (std::is_member_pointer_v<std::decay_t<decltype(member_ptr)>>) {
+                        read_partial<sub_partial, Opts>(value.*member_ptr, ctx, it, end, final_value);
+                     }
+                     else {
+                        read_partial<sub_partial, Opts>(member_ptr(value), ctx, it, end, final_value);
+                     }
+                  }
+                  else {
+                     static thread_local auto map_key = typename T::key_type(key_value);
+                     read_partial<sub_partial, Opts>(value[map_key], ctx, it, end, final_value);
+                  }
+
+                  if (!found[I]) {
+                     found[I] = true;
+                     --remaining;
+                  }
+               });
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+
+               if (!matched) {
+                  skip_object_value<Opts>(ctx, it, end);
+                  if (bool(ctx.error)) [[unlikely]]
+                     return;
+               }
+               else if (last && remaining == 0) {
+                  return;
+               }
+               skip_ws<Opts>(ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+            }
+            ctx.error = error_code::expected_end_brace;
+         }
+      }
    }  // namespace detail
    
    template <class T, class Buffer>
@@ -476,4 +1500,42 @@ namespace glz
       read<opts{}>(value, std::forward<Buffer>(buffer));
       return value;
    }
+   
+   template <class T, class Buffer>
+   [[nodiscard]] inline parse_error read_json(T& value, Buffer&& buffer, context& ctx) {
+      return read<opts{}>(value, std::forward<Buffer>(buffer), ctx);
+   }
+   
+   // Reads only the values at the given JSON pointers (see glz::json_ptrs), the counterpart of partial binary writes.
+   // Other values are skipped, and nothing after the last requested value is scanned.
+   template <auto& Partial, opts Opts = opts{}, class T, class Buffer>
+   [[nodiscard]] inline parse_error read_json(T& value, Buffer&& buffer, context& ctx) {
+      if constexpr (nano::ranges::input_range<std::decay_t<Buffer>>) {
+         ctx.reset();
+         auto b = std::ranges::begin(buffer);
+         auto e = std::ranges::end(buffer);
+         if (b == e) {
+            return {error_code::no_read_input};
+         }
+         const auto start = b;
+         detail::read_partial<Partial, Opts>(value, ctx, b, e, true);
+         ctx.index = nullptr;
+         if (bool(ctx.error)) [[unlikely]] {
+            return {ctx.error, static_cast<size_t>(std::distance(start, b))};
+         }
+         return {};
+      }
+      else {
+         return read_json<Partial, Opts>(value, std::string_view{buffer}, ctx);
+      }
+   }
+   
+   template <auto& Partial, class T, class Buffer>
+   inline void read_json(T& value, Buffer&& buffer) {
+      context ctx{};
+      const auto pe = read_json<Partial>(value, buffer, ctx);
+      if (pe) [[unlikely]] {
+         throw std::runtime_error(format_error(pe, buffer));
+      }
+   }
 }  // namespace glaze
@@ -0,0 +1,158 @@
+// Glaze Library
+// For the license information refer to glaze.hpp
+
+#pragma once
+
+#include <future>
+#include <vector>
+
+#include "glaze/json/read.hpp"
+#include "glaze/json/structural_index.hpp"
+#include "glaze/thread/threadpool.hpp"
+
+// Reads a large top level JSON array on a thread pool.
+// One structural scan finds the top level commas, the output is resized once, and contiguous runs of elements are
+// parsed concurrently straight into their slots.
+
+namespace glz
+{
+   namespace detail
+   {
+      template <class Buffer>
+      inline sv contiguous_view(Buffer&& buffer)
+      {
+         if constexpr (std::convertible_to<Buffer, sv>) {
+            return sv{buffer};
+         }
+         else {
+            static_assert(std::ranges::contiguous_range<Buffer>, "parallel reads need a contiguous buffer");
+            return {reinterpret_cast<const char*>(std::ranges::data(buffer)), std::ranges::size(buffer)};
+         }
+      }
+
+      // elements behind a proxy, such as the bits of std::vector<bool>, share storage and cannot be written from
+      // several threads, so they are read sequentially
+      template <opts Opts, class T>
+      requires(!std::is_lvalue_reference_v<decltype(std::declval<T&>()[0])>)
+      [[nodiscard]] inline parse_error read_parallel(T& value, const sv buffer, pool&, context& ctx)
+      {
+         return glz::read<Opts>(value, buffer, ctx);
+      }
+
+      template <opts Opts, class T>
+      [[nodiscard]] inline parse_error read_parallel(T& value, const sv buffer, pool& workers, context& ctx)
+      {
+         static_assert(resizeable<T> && requires { value[0]; }, "parallel reads need a resizable random access array");
+         ctx.reset();
+
+         auto it = buffer.data();
+         const auto end = buffer.data() + buffer.size();
+         const auto location = [&](const char* p) { return static_cast<size_t>(p - buffer.data()); };
+
+         skip_ws(ctx, it, end);
+         if (bool(ctx.error)) [[unlikely]]
+            return {ctx.error, location(it)};
+         if (it == end || *it != '[') [[unlikely]]
+            return {error_code::expected_bracket, location(it)};
+
+         const auto start = it;
+         static thread_local std::vector<size_t> offsets{};
+         offsets.clear();
+         auto& bounds = offsets; // the workers must see this thread's offsets, not their own
+         if (!index_array_elements(start, end, bounds)) {
+            // unclosed arrays and comments are left to the sequential reader
+            return glz::read<Opts>(value, buffer, ctx);
+         }
+         if (start[bounds.back()] != ']') [[unlikely]]
+            return {error_code::expected_end_bracket, location(start + bounds.back())};
+
+         size_t n = bounds.size() - 1;
+         if (n == 1) {
+            ++it;
+            skip_ws(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return {ctx.error, location(it)};
+            if (*it == ']') {
+               n = 0;
+            }
+         }
+         value.resize(n);
+         if (n == 0) {
+            return {};
+         }
+
+         // each task parses a contiguous run of elements and stops at its first error
+         // with opts.structural_index the run is indexed up front, so skips in all of its elements use one index
+         auto parse_run = [&](const size_t first, const size_t last) -> parse_error {
+            context local{};
+            local.resource = ctx.resource;
+            if constexpr (Opts.structural_index) {
+               thread_local structural_index index{};
+               index.build(start + bounds[first] + 1, start + bounds[last]);
+               local.index = &index;
+            }
+            for (size_t i = first; i < last; ++i) {
+               auto p = start + bounds[i] + 1;
+               const auto element_end = start + bounds[i + 1];
+               read<json>::op<Opts>(value[i], local, p, element_end);
+               if (!bool(local.error)) {
+                  skip_ws(local, p, element_end);
+               }
+               if (bool(local.error)) [[unlikely]]
+                  return {local.error, location(p)};
+               if (p != element_end) [[unlikely]]
+                  return {*element_end == ',' ? error_code::expected_comma : error_code::expected_end_bracket,
+                          location(p)};
+            }
+            return {};
+         };
+
+         const auto runs = std::min(n, std::max<size_t>(workers.size(), 1) * 4);
+         if (runs == 1) {
+            const auto pe = parse_run(0, n);
+            ctx.error = pe.ec;
+            return pe;
+         }
+
+         std::vector<std::future<parse_error>> results{};
+         results.reserve(runs);
+         for (size_t r = 0; r < runs; ++r) {
+            results.emplace_back(workers.emplace_back(
+               [&, first = n * r / runs, last = n * (r + 1) / runs](size_t) { return parse_run(first, last); }));
+         }
+         for (auto& result : results) {
+            result.wait(); // tasks reference this frame, so all must finish before an exception propagates
+         }
+         parse_error pe{};
+         for (auto& result : results) {
+            const auto run_error = result.get();
+            if (run_error && !pe) {
+               pe = run_error; // the earliest error in the document
+            }
+         }
+         ctx.error = pe.ec;
+         return pe;
+      }
+   }
+
+   // Reads a top level JSON array into a resizable container using the threads of a pool.
+   // Elements are parsed concurrently, so a context::resource must be safe to use from several threads.
+   // The calling thread waits for the tasks, so calling this from a task of the same pool can deadlock.
+   // With opts.structural_index each task indexes its run of elements once, so skips within the run use one index.
+   template <opts Opts = opts{}, class T, class Buffer>
+   [[nodiscard]] inline parse_error read_json_parallel(T& value, Buffer&& buffer, pool& workers, context& ctx)
+   {
+      return detail::read_parallel<Opts>(value, detail::contiguous_view(buffer), workers, ctx);
+   }
+
+   template <opts Opts = opts{}, class T, class Buffer>
+   inline void read_json_parallel(T& value, Buffer&& buffer, pool& workers)
+   {
+      context ctx{};
+      const auto view = detail::contiguous_view(buffer);
+      const auto pe = detail::read_parallel<Opts>(value, view, workers, ctx);
+      if (pe) [[unlikely]] {
+         throw std::runtime_error(format_error(pe, view));
+      }
+   }
+}
@@ -0,0 +1,270 @@
+// Glaze Library
+// For the license information refer to glaze.hpp
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "glaze/util/simd.hpp"
+
+// A stage 1 structural index in the style of simdjson.
+// The buffer is classified 64 bytes at a time into quote, backslash and bracket bitmasks, string interiors are
+// removed with a prefix xor, and every '{' / '[' is paired with its matching '}' / ']'. Skipping a subtree then becomes
+// a binary search for the opening offset and a jump to the recorded closing offset.
+
+namespace glz::detail
+{
+   struct structural_index final
+   {
+      const char* begin{};
+      const char* end{};
+      std::vector<uint32_t> opens{}; // offsets of '{' and '[' in increasing order
+      std::vector<uint32_t> closes{}; // matching close offset for each open (0 if unmatched)
+      size_t cursor{}; // reads move forward, so searches start after the last found open
+      bool valid{};
+
+      struct block_masks final
+      {
+         uint64_t quote{};
+         uint64_t backslash{};
+         uint64_t open{};
+         uint64_t close{};
+         uint64_t slash{};
+         uint64_t comma{};
+      };
+
+      static block_masks classify(const char* p) noexcept
+      {
+         block_masks m{};
+#if defined(GLZ_USE_AVX2) || defined(GLZ_USE_SSE2)
+         const auto quote = simd_set('"');
+         const auto backslash = simd_set('\\');
+         const auto lbrace = simd_set('{');
+         const auto rbrace = simd_set('}');
+         const auto lbracket = simd_set('[');
+         const auto rbracket = simd_set(']');
+         const auto slash = simd_set('/');
+         const auto comma = simd_set(',');
+         for (size_t i = 0; i < 64; i += simd_width) {
+            const auto chunk = simd_load(p + i);
+            m.quote |= uint64_t(simd_mask(simd_eq(chunk, quote))) << i;
+            m.backslash |= uint64_t(simd_mask(simd_eq(chunk, backslash))) << i;
+            m.open |= uint64_t(simd_mask(simd_or(simd_eq(chunk, lbrace), simd_eq(chunk, lbracket)))) << i;
+            m.close |= uint64_t(simd_mask(simd_or(simd_eq(chunk, rbrace), simd_eq(chunk, rbracket)))) << i;
+            m.slash |= uint64_t(simd_mask(simd_eq(chunk, slash))) << i;
+            m.comma |= uint64_t(simd_mask(simd_eq(chunk, comma))) << i;
+         }
+#else
+         for (size_t i = 0; i < 64; ++i) {
+            const uint64_t bit = uint64_t(1) << i;
+            switch (p[i]) {
+               case '"':
+                  m.quote |= bit;
+                  break;
+               case '\\':
+                  m.backslash |= bit;
+                  break;
+               case '{':
+               case '[':
+                  m.open |= bit;
+                  break;
+               case '}':
+               case ']':
+                  m.close |= bit;
+                  break;
+               case '/':
+                  m.slash |= bit;
+                  break;
+               case ',':
+                  m.comma |= bit;
+                  break;
+               default:
+                  break;
+            }
+         }
+#endif
+         return m;
+      }
+
+      // bit i of the result is the xor of bits [0, i] of x
+      static constexpr uint64_t prefix_xor(uint64_t x) noexcept
+      {
+         x ^= x << 1;
+         x ^= x << 2;
+         x ^= x << 4;
+         x ^= x << 8;
+         x ^= x << 16;
+         x ^= x << 32;
+         return x;
+      }
+
+      // the block at offset of a buffer of n bytes, zero padded past the end
+      static block_masks classify_at(const char* b, const size_t n, const size_t offset) noexcept
+      {
+         if (n - offset >= 64) {
+            return classify(b + offset);
+         }
+         char tail[64]{};
+         std::memcpy(tail, b + offset, n - offset);
+         return classify(tail);
+      }
+
+      // tracks escapes and strings that continue from one block into the next
+      struct string_state final
+      {
+         bool escape_carry{}; // the first character of the next block is escaped
+         uint64_t string_carry{}; // all ones if the next block starts inside a string
+
+         // the mask of characters that are escaped or inside a string (including the opening quote)
+         uint64_t quoted(const block_masks& m) noexcept
+         {
+            uint64_t escaped = escape_carry ? 1 : 0;
+            uint64_t bs = m.backslash & ~escaped;
+            escape_carry = false;
+            while (bs) {
+               const auto i = std::countr_zero(bs);
+               if (i == 63) {
+                  escape_carry = true;
+                  break;
+               }
+               escaped |= uint64_t(2) << i;
+               bs &= ~(uint64_t(3) << i); // the escaped character cannot start another escape
+            }
+
+            const uint64_t in_string = prefix_xor(m.quote & ~escaped) ^ string_carry;
+            string_carry = uint64_t(static_cast<int64_t>(in_string) >> 63);
+            return in_string | escaped;
+         }
+      };
+
+      // indexes [b, e), the index is only valid if no comments appear outside of strings
+      void build(const char* b, const char* e)
+      {
+         begin = b;
+         end = e;
+         opens.clear();
+         closes.clear();
+         cursor = 0;
+         valid = false;
+
+         const auto n = static_cast<size_t>(e - b);
+         if (n >= std::numeric_limits<uint32_t>::max()) {
+            return;
+         }
+
+         thread_local std::vector<uint32_t> stack{};
+         stack.clear();
+
+         string_state state{};
+         for (size_t offset = 0; offset < n; offset += 64) {
+            const auto m = classify_at(b, n, offset);
+            const auto quoted = state.quoted(m);
+
+            if (m.slash & ~quoted) {
+               return; // comments are skipped by the regular parser
+            }
+
+            uint64_t structurals = (m.open | m.close) & ~quoted;
+            while (structurals) {
+               const auto pos = static_cast<uint32_t>(offset + std::countr_zero(structurals));
+               structurals &= structurals - 1;
+               const auto c = b[pos];
+               if (c == '{' || c == '[') {
+                  stack.push_back(static_cast<uint32_t>(opens.size()));
+                  opens.push_back(pos);
+                  closes.push_back(0);
+               }
+               else if (stack.empty()) {
+                  // closes a container that began before the indexed range, such as the array holding the records
+                  // being read, the containers that follow it are still indexed
+                  continue;
+               }
+               else {
+                  const auto open = stack.back();
+                  stack.pop_back();
+                  if (b[opens[open]] != (c == '}' ? '{' : '[')) {
+                     return; // mismatched brackets, let the regular parser report the error
+                  }
+                  closes[open] = pos;
+               }
+            }
+         }
+
+         valid = true;
+      }
+
+      // returns a pointer to the character closing the container opened at p, or nullptr if it is not indexed
+      const char* find_close(const char* p) noexcept
+      {
+         if (!valid || p < begin || p >= end) {
+            return nullptr;
+         }
+         const auto offset = static_cast<uint32_t>(p - begin);
+         auto search = [&](auto first, auto last) {
+            const auto found = std::lower_bound(first, last, offset);
+            return (found != last && *found == offset) ? found : opens.end();
+         };
+         auto found = search(opens.begin() + cursor, opens.end());
+         if (found == opens.end()) {
+            found = search(opens.begin(), opens.begin() + cursor);
+         }
+         if (found == opens.end()) {
+            return nullptr;
+         }
+         const auto i = static_cast<size_t>(found - opens.begin());
+         if (closes[i] == 0) {
+            return nullptr;
+         }
+         cursor = i + 1;
+         return begin + closes[i];
+      }
+   };
+
+   // Finds the top level commas of the array opened by the '[' at b, for splitting it into elements.
+   // Appends the offsets (from b) of the '[', each separating ',' and the closing ']'.
+   // Returns false if the array is not closed or comments appear outside of strings.
+   inline bool index_array_elements(const char* b, const char* e, std::vector<size_t>& bounds)
+   {
+      const auto n = static_cast<size_t>(e - b);
+      structural_index::string_state state{};
+      size_t depth = 0;
+      for (size_t offset = 0; offset < n; offset += 64) {
+         const auto m = structural_index::classify_at(b, n, offset);
+         const auto quoted = state.quoted(m);
+         if (m.slash & ~quoted) {
+            return false;
+         }
+
+         uint64_t structurals = (m.open | m.close | m.comma) & ~quoted;
+         while (structurals) {
+            const auto pos = offset + std::countr_zero(structurals);
+            structurals &= structurals - 1;
+            switch (b[pos]) {
+            case '{':
+            case '[':
+               if (depth++ == 0) {
+                  bounds.push_back(pos);
+               }
+               break;
+            case '}':
+            case ']':
+               if (--depth == 0) {
+                  bounds.push_back(pos);
+                  return true;
+               }
+               break;
+            default:
+               if (depth == 1) {
+                  bounds.push_back(pos);
+               }
+            }
+         }
+      }
+      return false;
+   }
+}
@@ -3,19 +3,15 @@
 
 #pragma once
 
-#ifndef FMT_HEADER_ONLY
-#define FMT_HEADER_ONLY
-#endif  // !FMT_HEADER_ONLY
-#include "fmt/format.h"
-#include "fmt/compile.h"
-
-#include <charconv>
 #include <iterator>
 #include <ostream>
 
 #include "glaze/core/format.hpp"
 #include "glaze/util/for_each.hpp"
 #include "glaze/util/dump.hpp"
+#include "glaze/util/dtoa.hpp"
+#include "glaze/util/itoa.hpp"
+#include "glaze/util/simd.hpp"
 #include "glaze/json/from_ptr.hpp"
 
 namespace glz
@@ -25,6 +21,128 @@ namespace glz
       template <class T = void>
       struct to_json {};
       
+      // the escape sequence of a character that JSON strings cannot hold as is (RFC 8259)
+      struct escape_sequence final
+      {
+         char data[6]{};
+         uint8_t size{}; // zero for characters written as is
+
+         constexpr sv view() const noexcept { return {data, size}; }
+      };
+
+      inline constexpr auto escape_table = [] {
+         std::array<escape_sequence, 256> table{};
+         constexpr char hex[] = "0123456789abcdef";
+         for (size_t c = 0; c < 0x20; ++c) {
+            table[c] = {{'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF]}, 6};
+         }
+         table['\b'] = {{'\\', 'b'}, 2};
+         table['\f'] = {{'\\', 'f'}, 2};
+         table['\n'] = {{'\\', 'n'}, 2};
+         table['\r'] = {{'\\', 'r'}, 2};
+         table['\t'] = {{'\\', 't'}, 2};
+         table['"'] = {{'\\', '"'}, 2};
+         table['\\'] = {{'\\', '\\'}, 2};
+         return table;
+      }();
+
+      // the length of a string once quoted and escaped
+      constexpr size_t escaped_size(const sv str) noexcept
+      {
+         size_t n = str.size() + 2;
+         for (auto c : str) {
+            const auto escape = escape_table[static_cast<uint8_t>(c)].size;
+            n += escape ? escape - 1 : 0;
+         }
+         return n;
+      }
+
+      // Writers may give an upper bound on the size of their output, so that a whole value can be written into one
+      // reservation with no capacity checks per token. fixed_size<Opts>() is a compile time bound for types whose
+      // output size does not depend on the value, size_bound<Opts>(value) is a runtime bound for the rest.
+      template <class T, auto& Opts>
+      concept fixed_json_size = requires {
+         { to_json<std::decay_t<T>>::template fixed_size<Opts>() } -> std::same_as<size_t>;
+      };
+
+      template <class T, auto& Opts>
+      concept json_size_bounded = fixed_json_size<T, Opts> || requires(T&& value) {
+         { to_json<std::decay_t<T>>::template size_bound<Opts>(value) } -> std::same_as<size_t>;
+      };
+
+      template <auto& Opts, class T>
+      inline size_t json_size_bound(T&& value) noexcept
+      {
+         if constexpr (fixed_json_size<T, Opts>) {
+            return to_json<std::decay_t<T>>::template fixed_size<Opts>();
+         }
+         else {
+            return to_json<std::decay_t<T>>::template size_bound<Opts>(value);
+         }
+      }
+
+      // Pretty output (opts::prettify) is written directly by the writers of arrays and objects, which open and close
+      // levels of indentation. Writers take no context, so the depth is kept per thread, and indent and unindent are
+      // always paired so it returns to zero after every write.
+      inline thread_local uint32_t indentation_level{};
+
+      template <auto& Opts>
+      inline void write_newline(auto&&... args) noexcept
+      {
+         static constexpr auto block = [] {
+            std::array<char, 64> chars{};
+            chars.fill(Opts.indentation_char);
+            return chars;
+         }();
+         dump<'\n'>(args...);
+         auto n = static_cast<size_t>(indentation_level) * Opts.indentation_width;
+         while (n > 0) {
+            const auto k = std::min(n, block.size());
+            dump(sv{block.data(), k}, args...);
+            n -= k;
+         }
+      }
+
+      // after the opening bracket or brace of a non empty value
+      template <auto& Opts>
+      inline void indent(auto&&... args) noexcept
+      {
+         if constexpr (Opts.prettify) {
+            ++indentation_level;
+            write_newline<Opts>(args...);
+         }
+      }
+
+      // before the closing bracket or brace of a non empty value
+      template <auto& Opts>
+      inline void unindent(auto&&... args) noexcept
+      {
+         if constexpr (Opts.prettify) {
+            --indentation_level;
+            write_newline<Opts>(args...);
+         }
+      }
+
+      template <auto& Opts>
+      inline void write_comma(auto&&... args) noexcept
+      {
+         dump<','>(args...);
+         if constexpr (Opts.prettify) {
+            write_newline<Opts>(args...);
+         }
+      }
+
+      template <auto& Opts>
+      inline void write_colon(auto&&... args) noexcept
+      {
+         if constexpr (Opts.prettify) {
+            dump<": ">(args...);
+         }
+         else {
+            dump<':'>(args...);
+         }
+      }
+
       template <>
       struct write<json>
       {
@@ -37,6 +155,13 @@ namespace glz
          static void op(T&& value, B&& b, IX&& ix) {
             to_json<std::decay_t<T>>::template op<Opts>(std::forward<T>(value), std::forward<B>(b), std::forward<IX>(ix));
          }
+         
+         // pretty output is not bounded, its indentation depends on where the value is nested
+         template <auto& Opts, class T>
+         requires(!Opts.prettify && json_size_bounded<T, Opts>)
+         static size_t size_bound(T&& value) noexcept {
+            return json_size_bound<Opts>(value);
+         }
       };
       
       template <class T>
@@ -64,6 +189,12 @@ namespace glz
                dump<"false">(b, ix);
             }
          }
+         
+         template <auto& Opts>
+         static constexpr size_t fixed_size() noexcept
+         {
+            return 5;
+         }
       };
       
       template <num_t T>
@@ -72,36 +203,52 @@ namespace glz
          template <auto& Opts, class B>
          static void op(auto&& value, B&& b) noexcept
          {
-            /*if constexpr (std::same_as<std::decay_t<B>, std::string>) {
-               // more efficient strings in C++23:
-             https://en.cppreference.com/w/cpp/string/basic_string/resize_and_overwrite
-             }*/
             if constexpr (std::same_as<std::decay_t<B>, char*>) {
-               b = fmt::format_to(std::forward<B>(b), FMT_COMPILE("{}"), value);
+               b = to_chars(b, value);
             }
             else {
-               fmt::format_to(std::back_inserter(b), FMT_COMPILE("{}"), value);
+               char chars[fixed_size<Opts>()];
+               dump(sv{chars, static_cast<size_t>(to_chars(chars, value) - chars)}, b);
             }
          }
          
          template <auto& Opts, class B>
          static void op(auto&& value, B&& b, auto&& ix) noexcept
          {
-            /*if constexpr (std::same_as<std::decay_t<B>, std::string>) {
-               // more efficient strings in C++23:
-             https://en.cppreference.com/w/cpp/string/basic_string/resize_and_overwrite
-             }*/
-            
-            while (ix + 64 >= b.size()) [[unlikely]] {
-               b.resize(b.size() * 2);
+            static constexpr auto n = fixed_size<Opts>();
+            if (ix + n > b.size()) [[unlikely]] {
+               b.resize(std::max(b.size() * 2, ix + n));
             }
             
-            auto start = b.data() + ix;
-            auto end = fmt::format_to(start, FMT_COMPILE("{}"), value);
-            ix += std::distance(start, end);
+            const auto start = b.data() + ix;
+            ix += static_cast<size_t>(to_chars(start, value) - start);
+         }
+         
+         template <auto& Opts>
+         static constexpr size_t fixed_size() noexcept
+         {
+            using V = std::decay_t<T>;
+            if constexpr (std::integral<V>) {
+               return std::numeric_limits<V>::digits10 + 1 + std::is_signed_v<V>;
+            }
+            else {
+               return max_float_chars<V>;
+            }
+         }
+         
+         static char* to_chars(char* p, const std::decay_t<T> value) noexcept
+         {
+            if constexpr (std::integral<std::decay_t<T>>) {
+               return itoa(p, value);
+            }
+            else {
+               return dtoa(p, value);
+            }
          }
       };
 
+      // Clean runs between the characters that need escaping are found with a vector scan and copied whole, so only
+      // escapes are written a character at a time.
       template <class T>
       requires str_t<T> || char_t<T>
       struct to_json<T>
@@ -110,22 +257,29 @@ namespace glz
          static void op(auto&& value, auto&& b) noexcept
          {
             dump<'"'>(b);
-            const auto write_char = [&](auto&& c) {
-               switch (c) {
-               case '\\':
-               case '"':
-                  dump<'\\'>(b);
-                  break;
-               }
-               dump(c, b);
-            };
             if constexpr (char_t<T>) {
-               write_char(value);
+               const auto c = static_cast<uint32_t>(value);
+               if (c < escape_table.size() && escape_table[c].size) {
+                  dump(escape_table[c].view(), b);
+               }
+               else {
+                  dump(value, b);
+               }
             }
             else {
                const sv str = value;
-               for (auto&& c : str) {
-                  write_char(c);
+               auto p = str.data();
+               const auto e = p + str.size();
+               while (true) {
+                  const auto c = find_string_special(p, e);
+                  if (c != p) {
+                     dump(sv{p, static_cast<size_t>(c - p)}, b);
+                  }
+                  if (c == e) {
+                     break;
+                  }
+                  dump(escape_table[static_cast<uint8_t>(*c)].view(), b);
+                  p = c + 1;
                }
             }
             dump<'"'>(b);
@@ -134,95 +288,111 @@ namespace glz
          template <auto& Opts>
          static void op(auto&& value, auto&& b, auto&& ix) noexcept
          {
-            dump<'"'>(b, ix);
             if constexpr (char_t<T>) {
-               switch (value) {
-               case '\\':
-               case '"':
-                  dump<'\\'>(b, ix);
-                  break;
+               dump<'"'>(b, ix);
+               const auto c = static_cast<uint32_t>(value);
+               if (c < escape_table.size() && escape_table[c].size) {
+                  dump(escape_table[c].view(), b, ix);
                }
-               dump(value, b, ix);
+               else {
+                  dump(value, b, ix);
+               }
+               dump<'"'>(b, ix);
             }
             else {
                const sv str = value;
-               const auto n = str.size();
-               
-               // we use 2 * n to handle potential escape characters
-               while ((ix + 2 * n) >= b.size()) [[unlikely]] {
-                  b.resize(b.size() * 2);
-               }
-               
-               // now we don't have to check writing
-               for (auto&& c : str) {
-                  switch (c) {
-                  case '\\':
-                  case '"':
-                     b[ix] = '\\';
-                     ++ix;
+               auto p = str.data();
+               const auto e = p + str.size();
+
+               // room for the string unescaped with its quotes, escapes grow the buffer as they are reached
+               const auto reserve = [&](const size_t n) {
+                  if (ix + n >= b.size()) [[unlikely]] {
+                     b.resize(std::max(b.size() * 2, ix + n + 1));
+                  }
+               };
+               reserve(str.size() + 2);
+               b[ix] = '"';
+               ++ix;
+               while (true) {
+                  const auto c = find_string_special(p, e);
+                  const auto n = static_cast<size_t>(c - p);
+                  std::memcpy(b.data() + ix, p, n);
+                  ix += n;
+                  if (c == e) {
                      break;
                   }
-                  b[ix] = c;
-                  ++ix;
+                  const auto escape = escape_table[static_cast<uint8_t>(*c)].view();
+                  reserve(escape.size() + static_cast<size_t>(e - c));
+                  std::memcpy(b.data() + ix, escape.data(), escape.size());
+                  ix += escape.size();
+                  p = c + 1;
                }
+               b[ix] = '"';
+               ++ix;
             }
-            dump<'"'>(b, ix);
+         }
+         
+         template <auto& Opts>
+         requires char_t<T>
+         static constexpr size_t fixed_size() noexcept
+         {
+            return 8; // a quoted \u escape
+         }
+         
+         // exact, the escapes are counted with the same vector scan the writer uses
+         template <auto& Opts>
+         requires str_t<T>
+         static size_t size_bound(auto&& value) noexcept
+         {
+            const sv str = value;
+            auto p = str.data();
+            const auto e = p + str.size();
+            size_t n = str.size() + 2;
+            while ((p = find_string_special(p, e)) != e) {
+               n += escape_table[static_cast<uint8_t>(*p)].size - 1;
+               ++p;
+            }
+            return n;
          }
       };
 
+      // names are written from a compile time table of quoted names, assuming they need no escaping
       template <glaze_enum_t T>
       struct to_json<T>
       {
          template <auto& Opts>
          static void op(auto&& value, auto&& b) noexcept
          {
-            using key_t = std::underlying_type_t<T>;
-            static constexpr auto frozen_map =
-               detail::make_enum_to_string_map<T>();
-            const auto& member_it = frozen_map.find(static_cast<key_t>(value));
-            if (member_it != frozen_map.end()) {
-               const sv str = {member_it->second.data(),
-                                       member_it->second.size()};
-               // Note: Assumes people dont use strings with chars that need to
-               // be
-               // escaped for their enum names
-               // TODO: Could create a pre qouted map for better perf
-               dump<'"'>(b);
-               dump(str, b);
-               dump<'"'>(b);
+            const auto name = quoted_enum_name(value);
+            if (!name.empty()) [[likely]] {
+               dump(name, b);
             }
             else [[unlikely]] {
-               // What do we want to happen if the value doesnt have a mapped
-               // string
-               write<json>::op<Opts>(
-                  static_cast<std::underlying_type_t<T>>(value), b);
+               // values without a name are written as numbers
+               write<json>::op<Opts>(static_cast<std::underlying_type_t<T>>(value), b);
             }
          }
          
          template <auto& Opts>
          static void op(auto&& value, auto&& b, auto&& ix) noexcept
          {
-            using key_t = std::underlying_type_t<T>;
-            static constexpr auto frozen_map =
-               detail::make_enum_to_string_map<T>();
-            const auto& member_it = frozen_map.find(static_cast<key_t>(value));
-            if (member_it != frozen_map.end()) {
-               const sv str = {member_it->second.data(),
-                                       member_it->second.size()};
-               // Note: Assumes people dont use strings with chars that need to
-               // be
-               // escaped for their enum names
-               // TODO: Could create a pre qouted map for better perf
-               dump<'"'>(b, ix);
-               dump(str, b, ix);
-               dump<'"'>(b, ix);
+            const auto name = quoted_enum_name(value);
+            if (!name.empty()) [[likely]] {
+               dump(name, b, ix);
             }
             else [[unlikely]] {
-               // What do we want to happen if the value doesnt have a mapped
-               // string
-               write<json>::op<Opts>(
-                  static_cast<std::underlying_type_t<T>>(value), b, ix);
+               write<json>::op<Opts>(static_cast<std::underlying_type_t<T>>(value), b, ix);
+            }
+         }
+         
+         template <auto& Opts>
+         static constexpr size_t fixed_size() noexcept
+         {
+            size_t n = to_json<std::underlying_type_t<T>>::template fixed_size<Opts>();
+            for (auto& name : quoted_enum_names_v<T>) {
+               n = std::max(n, name.size());
             }
+            return n;
          }
       };
 
@@ -236,10 +406,16 @@ namespace glz
          template <auto& Opts>
          static void op(auto&& /*value*/, auto&& /*b*/, auto&& /*ix*/) noexcept
          {}
+         
+         template <auto& Opts>
+         static constexpr size_t fixed_size() noexcept
+         {
+            return 0;
+         }
       };
 
       template <class T>
-      requires std::same_as<std::decay_t<T>, raw_json>
+      requires std::same_as<std::decay_t<T>, raw_json> || std::same_as<std::decay_t<T>, raw_json_view>
       struct to_json<T>
       {
          template <auto& Opts>
@@ -251,6 +427,11 @@ namespace glz
          static void op(auto&& value, auto&& b, auto&& ix) noexcept {
             dump(value.str, b, ix);
          }
+         
+         template <auto& Opts>
+         static size_t size_bound(auto&& value) noexcept {
+            return value.str.size();
+         }
       };
       
       template <array_t T>
@@ -270,14 +451,16 @@ namespace glz
             }();
 
             if (!is_empty) {
+               indent<Opts>(b);
                auto it = value.begin();
                write<json>::op<Opts>(*it, b);
                ++it;
                const auto end = value.end();
                for (; it != end; ++it) {
-                  dump<','>(b);
+                  write_comma<Opts>(b);
                   write<json>::op<Opts>(*it, b);
                }
+               unindent<Opts>(b);
             }
             dump<']'>(b);
          }
@@ -296,17 +479,53 @@ namespace glz
             }();
 
             if (!is_empty) {
+               indent<Opts>(b, ix);
                auto it = value.begin();
                write<json>::op<Opts>(*it, b, ix);
                ++it;
                const auto end = value.end();
                for (; it != end; ++it) {
-                  dump<','>(b, ix);
+                  write_comma<Opts>(b, ix);
                   write<json>::op<Opts>(*it, b, ix);
                }
+               unindent<Opts>(b, ix);
             }
             dump<']'>(b, ix);
          }
+         
+         template <auto& Opts>
+         requires has_static_size<T> && fixed_json_size<nano::ranges::range_value_t<T>, Opts>
+         static constexpr size_t fixed_size() noexcept
+         {
+            constexpr size_t n = [] {
+               if constexpr (is_span<T>) {
+                  return T::extent;
+               }
+               else {
+                  return T{}.size();
+               }
+            }();
+            using V = std::decay_t<nano::ranges::range_value_t<T>>;
+            return 2 + n * (to_json<V>::template fixed_size<Opts>() + 1);
+         }
+         
+         // elements of a fixed size bound are not visited when the size of the range is known
+         template <auto& Opts>
+         requires json_size_bounded<nano::ranges::range_value_t<T>, Opts>
+         static size_t size_bound(auto&& value) noexcept
+         {
+            using V = nano::ranges::range_value_t<T>;
+            if constexpr (fixed_json_size<V, Opts> && nano::ranges::sized_range<T>) {
+               return 2 + value.size() * (to_json<std::decay_t<V>>::template fixed_size<Opts>() + 1);
+            }
+            else {
+               size_t n = 2;
+               for (auto&& v : value) {
+                  n += json_size_bound<Opts>(v) + 1;
+               }
+               return n;
+            }
+         }
       };
 
       template <map_t T>
@@ -317,61 +536,100 @@ namespace glz
          {
             dump<'{'>(b);
             if (!value.empty()) {
-               auto it = value.cbegin();
-               auto write_pair = [&] {
-                  using Key = decltype(it->first);
-                  if constexpr (str_t<Key> || char_t<Key>) {
-                     write<json>::op<Opts>(it->first, b);
-                  }
-                  else {
-                     dump<'"'>(b);
-                     write<json>::op<Opts>(it->first, b);
-                     dump<'"'>(b);
-                  }
-                  dump<':'>(b);
-                  write<json>::op<Opts>(it->second, b);
-               };
-               write_pair();
-               ++it;
-               
-               const auto end = value.cend();
-               for (; it != end; ++it) {
-                  dump<','>(b);
-                  write_pair();
-               }
+               indent<Opts>(b);
+               write_members<Opts>(value, b);
+               unindent<Opts>(b);
             }
             dump<'}'>(b);
          }
          
+         // the pairs of a non empty map without the braces
+         template <auto& Opts>
+         static void write_members(auto&& value, auto&& b) noexcept
+         {
+            auto it = value.cbegin();
+            auto write_pair = [&] {
+               using Key = decltype(it->first);
+               if constexpr (str_t<Key> || char_t<Key>) {
+                  write<json>::op<Opts>(it->first, b);
+               }
+               else {
+                  dump<'"'>(b);
+                  write<json>::op<Opts>(it->first, b);
+                  dump<'"'>(b);
+               }
+               write_colon<Opts>(b);
+               write<json>::op<Opts>(it->second, b);
+            };
+            write_pair();
+            ++it;
+            
+            const auto end = value.cend();
+            for (; it != end; ++it) {
+               write_comma<Opts>(b);
+               write_pair();
+            }
+         }
+         
          template <auto& Opts>
          static void op(auto&& value, auto&& b, auto&& ix) noexcept
          {
             dump<'{'>(b, ix);
             if (!value.empty()) {
-               auto it = value.cbegin();
-               auto write_pair = [&] {
-                  using Key = decltype(it->first);
-                  if constexpr (str_t<Key> || char_t<Key>) {
-                     write<json>::op<Opts>(it->first, b, ix);
-                  }
-                  else {
-                     dump<'"'>(b, ix);
-                     write<json>::op<Opts>(it->first, b, ix);
-                     dump<'"'>(b, ix);
-                  }
-                  dump<':'>(b, ix);
-                  write<json>::op<Opts>(it->second, b, ix);
-               };
+               indent<Opts>(b, ix);
+               write_members<Opts>(value, b, ix);
+               unindent<Opts>(b, ix);
+            }
+            dump<'}'>(b, ix);
+         }
+         
+         // the pairs of a non empty map without the braces
+         template <auto& Opts>
+         static void write_members(auto&& value, auto&& b, auto&& ix) noexcept
+         {
+            auto it = value.cbegin();
+            auto write_pair = [&] {
+               using Key = decltype(it->first);
+               if constexpr (str_t<Key> || char_t<Key>) {
+                  write<json>::op<Opts>(it->first, b, ix);
+               }
+               else {
+                  dump<'"'>(b, ix);
+                  write<json>::op<Opts>(it->first, b, ix);
+                  dump<'"'>(b, ix);
+               }
+               write_colon<Opts>(b, ix);
+               write<json>::op<Opts>(it->second, b, ix);
+            };
+            write_pair();
+            ++it;
+            
+            const auto end = value.cend();
+            for (; it != end; ++it) {
+               write_comma<Opts>(b, ix);
                write_pair();
-               ++it;
-               
-               const auto end = value.cend();
-               for (; it != end; ++it) {
-                  dump<','>(b, ix);
-                  write_pair();
+            }
+         }
+         
+         template <auto& Opts>
+         requires json_size_bounded<typename T::key_type, Opts> && json_size_bounded<typename T::mapped_type, Opts>
+         static size_t size_bound(auto&& value) noexcept
+         {
+            using Key = typename T::key_type;
+            using Mapped = typename T::mapped_type;
+            constexpr size_t quotes = str_t<Key> || char_t<Key> ? 0 : 2;
+            if constexpr (fixed_json_size<Key, Opts> && fixed_json_size<Mapped, Opts>) {
+               constexpr auto pair = to_json<Key>::template fixed_size<Opts>() + quotes +
+                                     to_json<Mapped>::template fixed_size<Opts>() + 2;
+               return 2 + value.size() * pair;
+            }
+            else {
+               size_t n = 2;
+               for (auto&& [k, v] : value) {
+                  n += json_size_bound<Opts>(k) + quotes + json_size_bound<Opts>(v) + 2;
                }
+               return n;
             }
-            dump<'}'>(b, ix);
          }
       };
       
@@ -397,71 +655,123 @@ namespace glz
                dump<"null">(b, ix);
             }
          }
+         
+         template <auto& Opts>
+         requires fixed_json_size<decltype(*std::declval<T&>()), Opts>
+         static constexpr size_t fixed_size() noexcept
+         {
+            using V = std::decay_t<decltype(*std::declval<T&>())>;
+            return std::max<size_t>(4, to_json<V>::template fixed_size<Opts>());
+         }
+         
+         template <auto& Opts>
+         requires json_size_bounded<decltype(*std::declval<T&>()), Opts>
+         static size_t size_bound(auto&& value) noexcept
+         {
+            return value ? json_size_bound<Opts>(*value) : 4;
+         }
+      };
+
+      template <class T, size_t I>
+      struct element_type
+      {
+         using type = std::tuple_element_t<I, T>;
+      };
+      
+      template <glaze_array_t T, size_t I>
+      struct element_type<T, I>
+      {
+         using type = decltype(std::declval<T&>().*std::get<I>(meta_v<T>));
       };
 
       template <class T>
       requires glaze_array_t<std::decay_t<T>> || tuple_t<std::decay_t<T>>
       struct to_json<T>
       {
+         using V = std::decay_t<T>;
+         
+         static constexpr auto N = [] {
+            if constexpr (glaze_array_t<V>) {
+               return std::tuple_size_v<meta_t<V>>;
+            }
+            else {
+               return std::tuple_size_v<V>;
+            }
+         }();
+         
+         template <size_t I>
+         static auto& element(auto&& value) noexcept
+         {
+            if constexpr (glaze_array_t<V>) {
+               return value.*std::get<I>(meta_v<V>);
+            }
+            else {
+               return std::get<I>(value);
+            }
+         }
+         
+         template <size_t I>
+         using element_t = typename element_type<V, I>::type;
+         
          template <auto& Opts>
          static void op(auto&& value, auto&& b) noexcept
          {
-            static constexpr auto N = []() constexpr
-            {
-               if constexpr (glaze_array_t<std::decay_t<T>>) {
-                  return std::tuple_size_v<meta_t<std::decay_t<T>>>;
-               }
-               else {
-                  return std::tuple_size_v<std::decay_t<T>>;
-               }
-            }
-            ();
-            
             dump<'['>(b);
-            using V = std::decay_t<T>;
+            if constexpr (N > 0) {
+               indent<Opts>(b);
+            }
             for_each<N>([&](auto I) {
-               if constexpr (glaze_array_t<V>) {
-                  write<json>::op<Opts>(value.*std::get<I>(meta_v<V>), b);
-               }
-               else {
-                  write<json>::op<Opts>(std::get<I>(value), b);
-               }
+               write<json>::op<Opts>(element<I>(value), b);
                if constexpr (I < N - 1) {
-                  dump<','>(b);
+                  write_comma<Opts>(b);
                }
             });
+            if constexpr (N > 0) {
+               unindent<Opts>(b);
+            }
             dump<']'>(b);
          }
          
          template <auto& Opts>
          static void op(auto&& value, auto&& b, auto&& ix) noexcept
          {
-            static constexpr auto N = []() constexpr
-            {
-               if constexpr (glaze_array_t<std::decay_t<T>>) {
-                  return std::tuple_size_v<meta_t<std::decay_t<T>>>;
-               }
-               else {
-                  return std::tuple_size_v<std::decay_t<T>>;
-               }
-            }
-            ();
-            
             dump<'['>(b, ix);
-            using V = std::decay_t<T>;
+            if constexpr (N > 0) {
+               indent<Opts>(b, ix);
+            }
             for_each<N>([&](auto I) {
-               if constexpr (glaze_array_t<V>) {
-                  write<json>::op<Opts>(value.*std::get<I>(meta_v<V>), b, ix);
-               }
-               else {
-                  write<json>::op<Opts>(std::get<I>(value), b, ix);
-               }
+               write<json>::op<Opts>(element<I>(value), b, ix);
                if constexpr (I < N - 1) {
-                  dump<','>(b, ix);
+                  write_comma<Opts>(b, ix);
                }
             });
+            if constexpr (N > 0) {
+               unindent<Opts>(b, ix);
+            }
             dump<']'>(b, ix);
          }
+         
+         template <auto& Opts>
+         requires([]<size_t... I>(std::index_sequence<I...>) {
+            return (fixed_json_size<element_t<I>, Opts> && ...);
+         }(std::make_index_sequence<N>{}))
+         static constexpr size_t fixed_size() noexcept
+         {
+            return [&]<size_t... I>(std::index_sequence<I...>) {
+               return 2 + N + (to_json<std::decay_t<element_t<I>>>::template fixed_size<Opts>() + ... + 0);
+            }(std::make_index_sequence<N>{});
+         }
+         
+         template <auto& Opts>
+         requires([]<size_t... I>(std::index_sequence<I...>) {
+            return (json_size_bounded<element_t<I>, Opts> && ...);
+         }(std::make_index_sequence<N>{}))
+         static size_t size_bound(auto&& value) noexcept
+         {
+            size_t n = 2 + N;
+            for_each<N>([&](auto I) { n += json_size_bound<Opts>(element<I>(value)); });
+            return n;
+         }
       };
       
       template <class T>
@@ -470,22 +780,49 @@ namespace glz
       {
          template <auto& Opts>
          static void op(auto&& value, auto&& b) noexcept
+         {
+            dump<'{'>(b);
+            if constexpr (N > 0) {
+               indent<Opts>(b);
+               write_members<Opts>(value, b);
+               unindent<Opts>(b);
+            }
+            dump<'}'>(b);
+         }
+         
+         template <auto& Opts>
+         static void op(auto&& value, auto&& b, auto&& ix) noexcept
+         {
+            dump<'{'>(b, ix);
+            if constexpr (N > 0) {
+               indent<Opts>(b, ix);
+               write_members<Opts>(value, b, ix);
+               unindent<Opts>(b, ix);
+            }
+            dump<'}'>(b, ix);
+         }
+         
+         // the members without the enclosing braces
+         template <auto& Opts>
+         static void write_members(auto&& value, auto&& b) noexcept
          {
             using V = std::decay_t<T>;
             static constexpr auto N = std::tuple_size_v<meta_t<V>>;
-            dump<'{'>(b);
             for_each<N>([&](auto I) {
                static constexpr auto item = std::get<I>(meta_v<V>);
                using Key =
                   typename std::decay_t<std::tuple_element_t<0, decltype(item)>>;
                if constexpr (str_t<Key> || char_t<Key>) {
                   write<json>::op<Opts>(std::get<0>(item), b);
-                  dump<':'>(b);
+                  write_colon<Opts>(b);
                }
                else {
                   static constexpr auto quoted =
                      concat_arrays(concat_arrays("\"", std::get<0>(item)), "\":");
                   write<json>::op<Opts>(quoted, b);
+                  if constexpr (Opts.prettify) {
+                     dump<' '>(b);
+                  }
                }
                if constexpr (std::is_member_pointer_v<
                                 std::tuple_element_t<1, decltype(item)>>) {
@@ -498,36 +835,40 @@ namespace glz
                if constexpr (Opts.comments && S > 2) {
                   constexpr sv comment = std::get<2>(item);
                   if constexpr (comment.size() > 0) {
+                     if constexpr (Opts.prettify) {
+                        dump<' '>(b);
+                     }
                      dump<"/*">(b);
                      dump(comment, b);
                      dump<"*/">(b);
                   }
                }
                if constexpr (I < N - 1) {
-                  dump<','>(b);
+                  write_comma<Opts>(b);
                }
             });
-            dump<'}'>(b);
          }
          
          template <auto& Opts>
-         static void op(auto&& value, auto&& b, auto&& ix) noexcept
+         static void write_members(auto&& value, auto&& b, auto&& ix) noexcept
          {
             using V = std::decay_t<T>;
             static constexpr auto N = std::tuple_size_v<meta_t<V>>;
-            dump<'{'>(b, ix);
             for_each<N>([&](auto I) {
                static constexpr auto item = std::get<I>(meta_v<V>);
                using Key =
                   typename std::decay_t<std::tuple_element_t<0, decltype(item)>>;
                if constexpr (str_t<Key> || char_t<Key>) {
                   write<json>::op<Opts>(std::get<0>(item), b, ix);
-                  dump<':'>(b, ix);
+                  write_colon<Opts>(b, ix);
                }
                else {
                   static constexpr auto quoted =
                      concat_arrays(concat_arrays("\"", std::get<0>(item)), "\":");
                   write<json>::op<Opts>(quoted, b, ix);
+                  if constexpr (Opts.prettify) {
+                     dump<' '>(b, ix);
+                  }
                }
                if constexpr (std::is_member_pointer_v<
                                 std::tuple_element_t<1, decltype(item)>>) {
@@ -540,20 +881,242 @@ namespace glz
                if constexpr (Opts.comments && S > 2) {
                   constexpr sv comment = std::get<2>(item);
                   if constexpr (comment.size() > 0) {
+                     if constexpr (Opts.prettify) {
+                        dump<' '>(b, ix);
+                     }
                      dump<"/*">(b, ix);
                      dump(comment, b, ix);
                      dump<"*/">(b, ix);
                   }
                }
                if constexpr (I < N - 1) {
-                  dump<','>(b, ix);
+                  write_comma<Opts>(b, ix);
                }
             });
-            dump<'}'>(b, ix);
+         }
+         
+         static constexpr auto N = std::tuple_size_v<meta_t<T>>;
+         
+         template <size_t I>
+         using member_t = decltype(get_member(std::declval<T&>(), std::get<1>(std::get<I>(meta_v<T>))));
+         
+         static constexpr bool string_keys = []<size_t... I>(std::index_sequence<I...>) {
+            return ((str_t<std::tuple_element_t<0, std::tuple_element_t<I, meta_t<T>>>> ||
+                     char_t<std::tuple_element_t<0, std::tuple_element_t<I, meta_t<T>>>>) && ...);
+         }(std::make_index_sequence<N>{});
+         
+         // everything but the member values: braces, quoted keys, colons, commas and comments
+         template <auto& Opts>
+         static constexpr size_t frame_size() noexcept
+         {
+            size_t n = 2 + 2 * N;
+            for_each<N>([&](auto I) {
+               constexpr auto item = std::get<I>(meta_v<T>);
+               using Key = std::decay_t<std::tuple_element_t<0, decltype(item)>>;
+               if constexpr (char_t<Key>) {
+                  n += 8;
+               }
+               else {
+                  n += escaped_size(std::get<0>(item));
+               }
+               if constexpr (Opts.comments && std::tuple_size_v<decltype(item)> > 2) {
+                  constexpr sv comment = std::get<2>(item);
+                  n += comment.size() > 0 ? comment.size() + 4 : 0;
+               }
+            });
+            return n;
+         }
+         
+         template <auto& Opts>
+         requires(string_keys && []<size_t... I>(std::index_sequence<I...>) {
+            return (fixed_json_size<member_t<I>, Opts> && ...);
+         }(std::make_index_sequence<N>{}))
+         static constexpr size_t fixed_size() noexcept
+         {
+            return [&]<size_t... I>(std::index_sequence<I...>) {
+               return frame_size<Opts>() + (to_json<std::decay_t<member_t<I>>>::template fixed_size<Opts>() + ... + 0);
+            }(std::make_index_sequence<N>{});
+         }
+         
+         template <auto& Opts>
+         requires(string_keys && []<size_t... I>(std::index_sequence<I...>) {
+            return (json_size_bounded<member_t<I>, Opts> && ...);
+         }(std::make_index_sequence<N>{}))
+         static size_t size_bound(auto&& value) noexcept
+         {
+            size_t n = frame_size<Opts>();
+            for_each<N>([&](auto I) { n += json_size_bound<Opts>(get_member(value, std::get<1>(std::get<I>(meta_v<T>)))); });
+            return n;
+         }
+      };
+      
+      template <>
+      struct to_json<std::monostate>
+      {
+         template <auto& Opts>
+         static void op(auto&& /*value*/, auto&& b) noexcept
+         {
+            dump<"null">(b);
+         }
+         
+         template <auto& Opts>
+         static void op(auto&& /*value*/, auto&& b, auto&& ix) noexcept
+         {
+            dump<"null">(b, ix);
+         }
+         
+         template <auto& Opts>
+         static constexpr size_t fixed_size() noexcept
+         {
+            return 4;
+         }
+      };
+      
+      // object and map alternatives of a tagged variant (see tag_v) begin with the tag, so readers can dispatch without
+      // rescanning
+      template <is_variant T>
+      struct to_json<T>
+      {
+         template <class V>
+         static constexpr bool tagged = !tag_v<T>.empty() && (glaze_object_t<V> || map_t<V>);
+         
+         template <auto& Opts>
+         static void op(auto&& value, auto&& b) noexcept
+         {
+            std::visit(
+               [&](auto&& v) {
+                  using V = std::decay_t<decltype(v)>;
+                  if constexpr (tagged<V>) {
+                     dump<'{'>(b);
+                     indent<Opts>(b);
+                     write<json>::op<Opts>(tag_v<T>, b);
+                     write_colon<Opts>(b);
+                     write<json>::op<Opts>(ids_v<T>[value.index()], b);
+                     if constexpr (map_t<V>) {
+                        if (!v.empty()) {
+                           write_comma<Opts>(b);
+                           to_json<V>::template write_members<Opts>(v, b);
+                        }
+                     }
+                     else if constexpr (std::tuple_size_v<meta_t<V>> > 0) {
+                        write_comma<Opts>(b);
+                        to_json<V>::template write_members<Opts>(v, b);
+                     }
+                     unindent<Opts>(b);
+                     dump<'}'>(b);
+                  }
+                  else {
+                     write<json>::op<Opts>(v, b);
+                  }
+               },
+               value);
+         }
+         
+         template <auto& Opts>
+         static void op(auto&& value, auto&& b, auto&& ix) noexcept
+         {
+            std::visit(
+               [&](auto&& v) {
+                  using V = std::decay_t<decltype(v)>;
+                  if constexpr (tagged<V>) {
+                     dump<'{'>(b, ix);
+                     indent<Opts>(b, ix);
+                     write<json>::op<Opts>(tag_v<T>, b, ix);
+                     write_colon<Opts>(b, ix);
+                     write<json>::op<Opts>(ids_v<T>[value.index()], b, ix);
+                     if constexpr (map_t<V>) {
+                        if (!v.empty()) {
+                           write_comma<Opts>(b, ix);
+                           to_json<V>::template write_members<Opts>(v, b, ix);
+                        }
+                     }
+                     else if constexpr (std::tuple_size_v<meta_t<V>> > 0) {
+                        write_comma<Opts>(b, ix);
+                        to_json<V>::template write_members<Opts>(v, b, ix);
+                     }
+                     unindent<Opts>(b, ix);
+                     dump<'}'>(b, ix);
+                  }
+                  else {
+                     write<json>::op<Opts>(v, b, ix);
+                  }
+               },
+               value);
+         }
+         
+         // the tag member that object and map alternatives begin with
+         static constexpr size_t tag_size = [] {
+            if constexpr (tag_v<T>.empty()) {
+               return size_t{};
+            }
+            else {
+               size_t id{};
+               for (auto& i : ids_v<T>) {
+                  id = std::max(id, escaped_size(i));
+               }
+               return escaped_size(tag_v<T>) + id + 2;
+            }
+         }();
+         
+         template <auto& Opts>
+         requires([]<size_t... I>(std::index_sequence<I...>) {
+            return (fixed_json_size<std::variant_alternative_t<I, T>, Opts> && ...);
+         }(std::make_index_sequence<std::variant_size_v<T>>{}))
+         static constexpr size_t fixed_size() noexcept
+         {
+            return []<size_t... I>(std::index_sequence<I...>) {
+               return std::max({(to_json<std::variant_alternative_t<I, T>>::template fixed_size<Opts>() +
+                                 (tagged<std::variant_alternative_t<I, T>> ? tag_size : 0))...});
+            }(std::make_index_sequence<std::variant_size_v<T>>{});
+         }
+         
+         template <auto& Opts>
+         requires([]<size_t... I>(std::index_sequence<I...>) {
+            return (json_size_bounded<std::variant_alternative_t<I, T>, Opts> && ...);
+         }(std::make_index_sequence<std::variant_size_v<T>>{}))
+         static size_t size_bound(auto&& value) noexcept
+         {
+            return std::visit(
+               [](auto&& v) {
+                  return json_size_bound<Opts>(v) + (tagged<std::decay_t<decltype(v)>> ? tag_size : 0);
+               },
+               value);
          }
       };
    }  // namespace detail
    
+   // The exact size of the output, found by running the writers into a buffer that only counts.
+   template <opts Opts = opts{}, class T>
+   [[nodiscard]] inline size_t measure_json(T&& value) noexcept {
+      detail::counter b{};
+      detail::write<json>::op<Opts>(value, b);
+      return b.size;
+   }
+   
+   // Writes into a fixed size buffer, such as a network send buffer or a shared memory slot. Nothing is written if the
+   // output does not fit, the result is then a buffer_overflow error with the size that is needed.
+   // A size bound that fits the buffer needs no measuring, so the exact size is only found when the bound does not fit.
+   template <opts Opts, class T>
+   requires(Opts.format == json)
+   [[nodiscard]] inline write_result write(T&& value, std::span<char> buffer) noexcept
+   {
+      using W = detail::write<json>;
+      if constexpr (requires { W::size_bound<Opts>(value); }) {
+         if (W::size_bound<Opts>(value) <= buffer.size()) {
+            auto p = buffer.data();
+            W::op<Opts>(value, p);
+            return {error_code::none, static_cast<size_t>(p - buffer.data())};
+         }
+      }
+      const auto n = measure_json<Opts>(value);
+      if (n > buffer.size()) {
+         return {error_code::buffer_overflow, n};
+      }
+      auto p = buffer.data();
+      W::op<Opts>(value, p);
+      return {error_code::none, n};
+   }
+   
    template <class T, class Buffer>
    inline auto write_json(T&& value, Buffer&& buffer) {
       return write<opts{}>(std::forward<T>(value), std::forward<Buffer>(buffer));
@@ -141,15 +141,14 @@ namespace glz
                continue;
             }
 
-            // Grab work
+            // Grab work, taking it out of the queue so that only queued work is left in it
             ++working;
-            auto work = queue.find(front_index++);
+            auto work = queue.extract(front_index++);
             lock.unlock();
 
-            work->second(thread_number);
+            work.mapped()(thread_number);
             
             lock.lock();
-            queue.erase(work);
 
             // Notify that work is finished
             --working;
@@ -0,0 +1,96 @@
+// Glaze Library
+// For the license information refer to glaze.hpp
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+// Integer parsing without a round trip through double.
+// Digits are consumed eight at a time with SWAR arithmetic on little endian targets.
+
+namespace glz::detail
+{
+   // true if all eight bytes are ascii digits
+   inline constexpr bool is_eight_digits(const uint64_t v) noexcept
+   {
+      return (((v & 0xF0F0F0F0F0F0F0F0) | (((v + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ==
+              0x3333333333333333);
+   }
+
+   // the value of eight ascii digits loaded in little endian order
+   inline constexpr uint32_t parse_eight_digits(uint64_t v) noexcept
+   {
+      v -= 0x3030303030303030;
+      v = (v * 10) + (v >> 8); // pairs of digits
+      v = (((v & 0x000000FF000000FF) * (100 + (1000000ULL << 32))) +
+           (((v >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32)))) >> 32;
+      return static_cast<uint32_t>(v);
+   }
+
+   // Accumulates the decimal digits at p into acc, leaving p at the first non digit.
+   // Returns false if the value does not fit in 64 bits.
+   inline bool parse_digits(uint64_t& acc, const char*& p, const char* end) noexcept
+   {
+      while (p < end && *p == '0') {
+         ++p; // leading zeros do not count toward the digit limit
+      }
+      const auto start = p;
+      if constexpr (std::endian::native == std::endian::little) {
+         while (end - p >= 8) {
+            uint64_t chunk;
+            std::memcpy(&chunk, p, 8);
+            if (!is_eight_digits(chunk)) {
+               break;
+            }
+            acc = acc * 100000000 + parse_eight_digits(chunk);
+            p += 8;
+         }
+      }
+      while (p < end && static_cast<uint8_t>(*p - '0') < 10) {
+         acc = acc * 10 + static_cast<uint8_t>(*p - '0');
+         ++p;
+      }
+
+      // uint64_t holds every 19 digit number and 20 digit numbers up to 18446744073709551615
+      const auto n = p - start;
+      if (n > 20) [[unlikely]] {
+         return false;
+      }
+      else if (n == 20 && std::memcmp(start, "18446744073709551615", 20) > 0) [[unlikely]] {
+         return false; // equal length digit strings compare like their values
+      }
+      return true;
+   }
+
+   // checks that a magnitude fits in T and applies the sign, -0 is accepted for unsigned types
+   template <class T>
+   inline bool to_integer(T& value, const uint64_t magnitude, const bool negative) noexcept
+   {
+      if constexpr (std::is_unsigned_v<T>) {
+         if ((negative && magnitude) || magnitude > std::numeric_limits<T>::max()) [[unlikely]] {
+            return false;
+         }
+         value = static_cast<T>(magnitude);
+      }
+      else {
+         constexpr auto max = static_cast<uint64_t>(std::numeric_limits<T>::max());
+         if (magnitude > max + negative) [[unlikely]] {
+            return false;
+         }
+         value = static_cast<T>(negative ? 0 - magnitude : magnitude);
+      }
+      return true;
+   }
+
+   // whether a double is within the range of T, used when integers are written with a fraction or exponent
+   template <class T>
+   inline constexpr bool in_range(const double d) noexcept
+   {
+      constexpr double lower = static_cast<double>(std::numeric_limits<T>::min());
+      constexpr double upper = static_cast<double>(std::numeric_limits<T>::max() / 2 + 1) * 2.0; // exclusive
+      return d >= lower && d < upper;
+   }
+}
@@ -0,0 +1,153 @@
+// Glaze Library
+// For the license information refer to glaze.hpp
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+// Pull based input for reading from streams and file descriptors.
+// Data is read in fixed size blocks, so memory stays bounded no matter how large the input is, and the parser scans
+// each block as a contiguous window. Tokens that straddle two blocks are continued after a refill.
+
+namespace glz
+{
+   // reads from a std::istream
+   // Only what the stream has already buffered is taken, at least one character, so reading a value from a pipe or a
+   // terminal returns once the value is complete and the characters after it can be put back.
+   struct istream_source final
+   {
+      std::istream& is;
+
+      size_t read(char* data, const size_t n)
+      {
+         const auto available = std::max<std::streamsize>(is.rdbuf()->in_avail(), 1);
+         const auto count = is.rdbuf()->sgetn(data, std::min(static_cast<std::streamsize>(n), available));
+         return static_cast<size_t>(count);
+      }
+   };
+
+#if defined(__unix__) || defined(__APPLE__)
+   // reads blocks from a POSIX file descriptor, which is not closed
+   struct fd_source final
+   {
+      int fd{};
+      int error{}; // the errno of a failed read, the input ends there and reads report error_code::read_failure
+
+      size_t read(char* data, const size_t n)
+      {
+         while (true) {
+            const auto count = ::read(fd, data, n);
+            if (count >= 0) {
+               return static_cast<size_t>(count);
+            }
+            else if (errno != EINTR) {
+               error = errno;
+               return 0;
+            }
+         }
+      }
+
+      bool failed() const noexcept { return error != 0; }
+   };
+#endif
+
+   template <class T>
+   concept read_source = requires(T& source, char* data, size_t n)
+   {
+      {
+         source.read(data, n)
+         } -> std::convertible_to<size_t>;
+   };
+
+   namespace detail
+   {
+      // sources that can fail provide failed(), otherwise reading nothing is the end of the input
+      inline bool source_failed(const auto& source) noexcept
+      {
+         if constexpr (requires { source.failed(); }) {
+            return source.failed();
+         }
+         else {
+            return false;
+         }
+      }
+
+      template <read_source Source, size_t N = 65536>
+      struct buffered_input final
+      {
+         Source source;
+         std::unique_ptr<char[]> buffer = std::make_unique<char[]>(N);
+         const char* cur = buffer.get();
+         const char* last = cur;
+         size_t consumed{}; // bytes in blocks before the current one
+         bool ended{};
+
+         // returns false at the end of the input
+         bool refill()
+         {
+            if (ended) {
+               return false;
+            }
+            consumed += static_cast<size_t>(last - buffer.get());
+            const auto n = source.read(buffer.get(), N);
+            cur = buffer.get();
+            last = cur + n;
+            ended = n == 0;
+            return n > 0;
+         }
+
+         // the offset of the cursor from the start of the input
+         size_t position() const noexcept { return consumed + static_cast<size_t>(cur - buffer.get()); }
+      };
+
+      // An input iterator over a buffered_input, compared against std::default_sentinel.
+      // Copies share the same input, so only one of them may be advanced.
+      template <class Input>
+      struct buffered_iterator final
+      {
+         using iterator_category = std::input_iterator_tag;
+         using value_type = char;
+         using difference_type = std::ptrdiff_t;
+         using pointer = const char*;
+         using reference = const char&;
+
+         Input* in{};
+
+         const char& operator*() const noexcept { return *in->cur; }
+
+         buffered_iterator& operator++()
+         {
+            ++in->cur;
+            return *this;
+         }
+
+         void operator++(int) { ++*this; }
+
+         // a block is only read once the current one is used up and more input is needed, so reading a value that
+         // ends with the available input does not wait for more
+         bool operator==(std::default_sentinel_t) const { return in->cur == in->last && !in->refill(); }
+
+         // the characters available without a refill, never empty unless the input has ended
+         std::pair<const char*, const char*> window() const
+         {
+            if (in->cur == in->last) {
+               in->refill();
+            }
+            return {in->cur, in->last};
+         }
+
+         // moves forward within the window
+         void advance(const size_t n) noexcept { in->cur += n; }
+      };
+   }
+}
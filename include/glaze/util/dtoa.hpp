@@ -0,0 +1,85 @@
+// Glaze Library
+// For the license information refer to glaze.hpp
+
+#pragma once
+
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstring>
+
+// Shortest round trip floating point formatting, laid out as "{}" is by {fmt}: positional notation for decimal
+// exponents in [-4, 16) and scientific notation with at least two exponent digits otherwise, e.g. 0.0001, 1e-05,
+// 1000000000000000 and 1e+16.
+// The shortest digits come from std::to_chars in scientific notation, which is Ryu based in the standard libraries.
+// Its positional notation is not used because it writes integers exactly rather than to the shortest digits.
+
+namespace glz::detail
+{
+   // the most characters dtoa writes for T
+   template <std::floating_point T>
+   inline constexpr size_t max_float_chars = sizeof(T) <= 8 ? 32 : 64;
+
+   // Writes value at p, which must have room for max_float_chars<T>, and returns the end of the output.
+   // Only the output itself is written, so a buffer measured for it exactly is enough.
+   template <std::floating_point T>
+   inline char* dtoa(char* p, const T value) noexcept
+   {
+      if (!std::isfinite(value) || value == 0) [[unlikely]] {
+         return std::to_chars(p, p + max_float_chars<T>, value).ptr;
+      }
+
+      // [-]d[.ddd]e(+|-)dd[d], which can be longer than the positional output, so it is formatted aside
+      char sci[max_float_chars<T>];
+      const auto end = std::to_chars(sci, sci + max_float_chars<T>, value, std::chars_format::scientific).ptr;
+      const auto digits = sci + (sci[0] == '-');
+      auto e = digits + 1;
+      while (*e != 'e') {
+         ++e;
+      }
+      int exp{};
+      for (auto c = e + 2; c < end; ++c) {
+         exp = exp * 10 + (*c - '0');
+      }
+      if (e[1] == '-') {
+         exp = -exp;
+      }
+      if (exp < -4 || exp >= 16) {
+         const auto n = static_cast<size_t>(end - sci);
+         std::memcpy(p, sci, n);
+         return p + n;
+      }
+
+      // the significant digits without the decimal point
+      char buffer[max_float_chars<T>];
+      buffer[0] = *digits;
+      size_t n = 1;
+      if (e > digits + 1) {
+         n += static_cast<size_t>(e - (digits + 2));
+         std::memcpy(buffer + 1, digits + 2, n - 1);
+      }
+
+      auto out = p;
+      if (digits != sci) {
+         *out++ = '-';
+      }
+      if (exp < 0) {
+         const auto zeros = static_cast<size_t>(-exp - 1);
+         out[0] = '0';
+         out[1] = '.';
+         std::memset(out + 2, '0', zeros);
+         std::memcpy(out + 2 + zeros, buffer, n);
+         return out + 2 + zeros + n;
+      }
+      const auto whole = static_cast<size_t>(exp + 1);
+      if (n <= whole) {
+         std::memcpy(out, buffer, n);
+         std::memset(out + n, '0', whole - n);
+         return out + whole;
+      }
+      std::memcpy(out, buffer, whole);
+      out[whole] = '.';
+      std::memcpy(out + whole + 1, buffer + whole, n - whole);
+      return out + n + 1;
+   }
+}
@@ -10,6 +10,30 @@
 
 namespace glz::detail
 {
+   // a buffer that only counts the characters written to it, for measuring output
+   struct counter final
+   {
+      size_t size{};
+   };
+
+   inline void dump(const char, counter& b) noexcept {
+      ++b.size;
+   }
+
+   template <char c>
+   inline void dump(counter& b) noexcept {
+      ++b.size;
+   }
+
+   template <string_literal str>
+   inline void dump(counter& b) noexcept {
+      b.size += str.sv().size();
+   }
+
+   inline void dump(const std::string_view str, counter& b) noexcept {
+      b.size += str.size();
+   }
+   
    inline void dump(const char c, std::string& b) noexcept {
       b.push_back(c);
    }
@@ -107,10 +131,8 @@ namespace glz::detail
    }
    
    inline void dump(const std::string_view str, char*& b) noexcept {
-      for (auto& c : str) {
-         *b = c;
-         ++b;
-      }
+      std::memcpy(b, str.data(), str.size());
+      b += str.size();
    }
    
    template <std::byte c, class B>
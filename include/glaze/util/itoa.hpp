@@ -0,0 +1,71 @@
+// Glaze Library
+// For the license information refer to glaze.hpp
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+
+// Integer formatting without a round trip through a format library.
+// The length is known before writing, from the bit width and one comparison, so digits are written from the back two
+// at a time out of a table of the hundred digit pairs.
+
+namespace glz::detail
+{
+   inline constexpr auto digit_pairs = [] {
+      std::array<char, 200> pairs{};
+      for (size_t i = 0; i < 100; ++i) {
+         pairs[2 * i] = static_cast<char>('0' + i / 10);
+         pairs[2 * i + 1] = static_cast<char>('0' + i % 10);
+      }
+      return pairs;
+   }();
+
+   // the number of decimal digits in x, one for zero
+   inline constexpr uint32_t digit_count(const uint64_t x) noexcept
+   {
+      constexpr auto powers = [] {
+         std::array<uint64_t, 20> p{};
+         p[0] = 1;
+         for (size_t i = 1; i < p.size(); ++i) {
+            p[i] = p[i - 1] * 10;
+         }
+         return p;
+      }();
+      // floor(log10(2) * bit width) is the digit count or one less, the next power of ten decides
+      const auto y = x | 1;
+      const uint32_t guess = (static_cast<uint32_t>(std::bit_width(y)) * 1233) >> 12;
+      return guess + (y >= powers[guess]);
+   }
+
+   // Writes value in decimal at p, which must have room for its digits and sign, and returns the end of the output.
+   template <std::integral T>
+   inline char* itoa(char* p, const T value) noexcept
+   {
+      uint64_t u = static_cast<uint64_t>(value);
+      if constexpr (std::is_signed_v<T>) {
+         if (value < 0) {
+            *p++ = '-';
+            u = 0 - u;
+         }
+      }
+
+      const auto end = p + digit_count(u);
+      auto q = end;
+      while (u >= 100) {
+         q -= 2;
+         std::memcpy(q, digit_pairs.data() + 2 * (u % 100), 2);
+         u /= 100;
+      }
+      if (u >= 10) {
+         std::memcpy(q - 2, digit_pairs.data() + 2 * u, 2);
+      }
+      else {
+         q[-1] = static_cast<char>('0' + u);
+      }
+      return end;
+   }
+}
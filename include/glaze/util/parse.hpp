@@ -3,15 +3,75 @@
 
 #pragma once
 
+#include <iterator>
+#include <memory>
+#include <utility>
+
+#include "glaze/core/context.hpp"
+#include "glaze/util/simd.hpp"
+
 namespace glz::detail
 {
+   template <class It>
+   concept contiguous_iterator = std::contiguous_iterator<std::decay_t<It>>;
+   
+   // iterators over block buffered input that expose the current block for vectorized scanning
+   template <class It>
+   concept windowed_iterator = requires(std::decay_t<It>& it)
+   {
+      it.window();
+      it.advance(size_t{});
+   };
+   
+   // pointer to the current position and the end for vectorized scanning of contiguous buffers
+   // std::to_address does not dereference, so it is also valid when it == end
+   inline auto to_pointers(auto&& it, auto&& end) noexcept
+   {
+      const char* p = std::to_address(it);
+      const char* e = std::to_address(end);
+      return std::pair{p, e};
+   }
+
+   // the characters that can be scanned in place, the rest of a contiguous buffer or the current block of buffered input
+   inline auto scan_window(auto&& it, auto&& end) noexcept
+   {
+      if constexpr (windowed_iterator<decltype(it)>) {
+         return it.window();
+      }
+      else {
+         return to_pointers(it, end);
+      }
+   }
+
+   // moves forward by n characters of the scan_window
+   inline void scan_advance(auto&& it, const size_t n)
+   {
+      if constexpr (windowed_iterator<decltype(it)>) {
+         it.advance(n);
+      }
+      else {
+         it += n;
+      }
+   }
+
+   template <char c>
+   inline constexpr error_code expected_error() noexcept
+   {
+      if constexpr (c == '"') return error_code::expected_quote;
+      else if constexpr (c == ',') return error_code::expected_comma;
+      else if constexpr (c == ':') return error_code::expected_colon;
+      else if constexpr (c == '{') return error_code::expected_brace;
+      else if constexpr (c == '}') return error_code::expected_end_brace;
+      else if constexpr (c == '[') return error_code::expected_bracket;
+      else if constexpr (c == ']') return error_code::expected_end_bracket;
+      else return error_code::syntax_error;
+   }
+   
    template <char c>
-   inline void match(auto&& it, auto&& end)
+   inline void match(auto&& ctx, auto&& it, auto&& end) noexcept
    {
       if (it == end || *it != c) [[unlikely]] {
-         static constexpr char b[] = {c, '\0'};
-         static constexpr auto error = concat_arrays("Expected:", b);
-         throw std::runtime_error(error.data());
+         ctx.error = expected_error<c>();
       }
       else [[likely]] {
          ++it;
@@ -19,33 +79,43 @@ namespace glz::detail
    }
 
    template <string_literal str>
-   inline void match(auto&& it, auto&& end)
-   {
-      const auto n = static_cast<size_t>(std::distance(it, end));
-      if (n < str.size) [[unlikely]] {
-         // TODO: compile time generate this message, currently borken with
-         // MSVC
-         static constexpr auto error = "Unexpected end of buffer. Expected:";
-         throw std::runtime_error(error);
-      }
-      size_t i{};
-      // clang and gcc will vectorize this loop
-      for (auto* c = str.value; c < str.end(); ++it, ++c) {
-         i += *it != *c;
-      }
-      if (i != 0) [[unlikely]] {
-         // TODO: compile time generate this message, currently borken with
-         // MSVC
-         static constexpr auto error = "Expected: ";
-         throw std::runtime_error(error);
+   inline void match(auto&& ctx, auto&& it, auto&& end) noexcept
+   {
+      if constexpr (contiguous_iterator<decltype(it)>) {
+         const auto n = static_cast<size_t>(end - it);
+         if (n < str.size) [[unlikely]] {
+            ctx.error = error_code::unexpected_end;
+            return;
+         }
+         size_t i{};
+         // clang and gcc will vectorize this loop
+         for (auto* c = str.value; c < str.end(); ++it, ++c) {
+            i += *it != *c;
+         }
+         if (i != 0) [[unlikely]] {
+            ctx.error = error_code::syntax_error;
+         }
+      }
+      else {
+         // input iterators cannot be measured without consuming them
+         for (auto* c = str.value; c < str.end(); ++it, ++c) {
+            if (it == end) [[unlikely]] {
+               ctx.error = error_code::unexpected_end;
+               return;
+            }
+            if (*it != *c) [[unlikely]] {
+               ctx.error = error_code::syntax_error;
+               return;
+            }
+         }
       }
    }
 
-   inline void skip_comment(auto&& it, auto&& end)
+   inline void skip_comment(auto&& ctx, auto&& it, auto&& end) noexcept
    {
       ++it;
       if (it == end) [[unlikely]]
-         throw std::runtime_error("Unexpected end, expected comment");
+         ctx.error = error_code::unexpected_end;
       else if (*it == '/') {
          while (++it != end && *it != '\n')
             ;
@@ -63,18 +133,55 @@ namespace glz::detail
          }
       }
       else [[unlikely]]
-         throw std::runtime_error("Expected / or * after /");
+         ctx.error = error_code::expected_comment;
    }
 
-   inline void skip_ws(auto&& it, auto&& end)
+   inline void skip_ws(auto&& ctx, auto&& it, auto&& end) noexcept
    {
+      if constexpr (contiguous_iterator<decltype(it)>) {
+         while (it != end) {
+            const auto [p, e] = to_pointers(it, end);
+            it += skip_ws_simd(p, e) - p;
+            if (it != end && *it == '/') {
+               skip_comment(ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+            }
+            else {
+               break;
+            }
+         }
+         return;
+      }
+      else if constexpr (windowed_iterator<decltype(it)>) {
+         while (it != end) {
+            const auto [p, e] = it.window();
+            const auto c = skip_ws_simd(p, e);
+            it.advance(static_cast<size_t>(c - p));
+            if (c == e) {
+               continue; // the block was all whitespace
+            }
+            else if (*it == '/') {
+               skip_comment(ctx, it, end);
+               if (bool(ctx.error)) [[unlikely]]
+                  return;
+            }
+            else {
+               break;
+            }
+         }
+         return;
+      }
+      
       while (it != end) {
          // assuming ascii
          if (static_cast<uint8_t>(*it) < 33) {
             ++it;
          }
          else if (*it == '/') {
-            skip_comment(it, end);
+            skip_comment(ctx, it, end);
+            if (bool(ctx.error)) [[unlikely]]
+               return;
          }
          else {
             break;
@@ -82,46 +189,264 @@ namespace glz::detail
       }
    }
 
-   inline void skip_string(auto&& it, auto&& end) noexcept
+   inline uint32_t read_hex4(auto&& ctx, auto&& it, auto&& end) noexcept
+   {
+      uint32_t value{};
+      for (size_t i = 0; i < 4; ++i, ++it) {
+         if (it == end) [[unlikely]] {
+            ctx.error = error_code::unexpected_end;
+            return 0;
+         }
+         const auto c = static_cast<uint8_t>(*it);
+         uint32_t digit{};
+         if (c >= '0' && c <= '9') {
+            digit = c - '0';
+         }
+         else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f') {
+            digit = (c | 0x20) - 'a' + 10;
+         }
+         else [[unlikely]] {
+            ctx.error = error_code::invalid_escape;
+            return 0;
+         }
+         value = (value << 4) | digit;
+      }
+      return value;
+   }
+
+   // decodes the escape sequence after a backslash and returns its code point
+   // a \u escape of a high surrogate must be followed by one of a low surrogate, and the pair is combined
+   inline uint32_t read_escape(auto&& ctx, auto&& it, auto&& end) noexcept
    {
+      if (it == end) [[unlikely]] {
+         ctx.error = error_code::expected_quote;
+         return 0;
+      }
+      const auto c = *it;
       ++it;
-      while (it < end) {
+      switch (c) {
+      case '"':
+      case '\\':
+      case '/':
+         return static_cast<uint32_t>(c);
+      case 'b':
+         return '\b';
+      case 'f':
+         return '\f';
+      case 'n':
+         return '\n';
+      case 'r':
+         return '\r';
+      case 't':
+         return '\t';
+      case 'u': {
+         const auto high = read_hex4(ctx, it, end);
+         if (bool(ctx.error)) [[unlikely]]
+            return 0;
+         if (high < 0xD800 || high > 0xDFFF) [[likely]] {
+            return high;
+         }
+         if (high > 0xDBFF) [[unlikely]] {
+            ctx.error = error_code::invalid_escape; // a low surrogate on its own
+            return 0;
+         }
+         match<'\\'>(ctx, it, end);
+         if (bool(ctx.error)) [[unlikely]] {
+            ctx.error = error_code::invalid_escape;
+            return 0;
+         }
+         match<'u'>(ctx, it, end);
+         if (bool(ctx.error)) [[unlikely]] {
+            ctx.error = error_code::invalid_escape;
+            return 0;
+         }
+         const auto low = read_hex4(ctx, it, end);
+         if (bool(ctx.error)) [[unlikely]]
+            return 0;
+         if (low < 0xDC00 || low > 0xDFFF) [[unlikely]] {
+            ctx.error = error_code::invalid_escape;
+            return 0;
+         }
+         return 0x10000 + ((high - 0xD800) << 10) + (low - 0xDC00);
+      }
+      default:
+         ctx.error = error_code::invalid_escape;
+         return 0;
+      }
+   }
+
+   // writes a code point as UTF-8, returns the number of bytes (at most 4)
+   inline size_t to_utf8(const uint32_t code_point, char* out) noexcept
+   {
+      if (code_point < 0x80) {
+         out[0] = static_cast<char>(code_point);
+         return 1;
+      }
+      else if (code_point < 0x800) {
+         out[0] = static_cast<char>(0xC0 | (code_point >> 6));
+         out[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+         return 2;
+      }
+      else if (code_point < 0x10000) {
+         out[0] = static_cast<char>(0xE0 | (code_point >> 12));
+         out[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+         out[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+         return 3;
+      }
+      out[0] = static_cast<char>(0xF0 | (code_point >> 18));
+      out[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+      out[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+      out[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+      return 4;
+   }
+
+   inline void skip_string(auto&& ctx, auto&& it, auto&& end) noexcept
+   {
+      ++it;
+      if constexpr (contiguous_iterator<decltype(it)>) {
+         const auto [p, e] = to_pointers(it, end);
+         auto c = p;
+         while (true) {
+            c = find_first_of<'"', '\\'>(c, e);
+            if (c == e) [[unlikely]] {
+               ctx.error = error_code::expected_quote;
+               break;
+            }
+            else if (*c == '"') {
+               ++c;
+               break;
+            }
+            else if (++c == e) [[unlikely]] {
+               ctx.error = error_code::expected_quote;
+               break;
+            }
+            ++c; // skip the escaped character
+         }
+         it += c - p;
+         return;
+      }
+      else if constexpr (windowed_iterator<decltype(it)>) {
+         while (it != end) {
+            const auto [p, e] = it.window();
+            const auto c = find_first_of<'"', '\\'>(p, e);
+            if (c == e) {
+               it.advance(static_cast<size_t>(e - p));
+            }
+            else if (*c == '"') {
+               it.advance(static_cast<size_t>(c - p) + 1);
+               return;
+            }
+            else {
+               it.advance(static_cast<size_t>(c - p) + 1);
+               if (it == end) [[unlikely]]
+                  break;
+               ++it; // skip the escaped character
+            }
+         }
+         ctx.error = error_code::expected_quote;
+         return;
+      }
+      
+      while (it != end) {
          if (*it == '"') {
             ++it;
-            break;
+            return;
          }
          else if (*it == '\\' && ++it == end) [[unlikely]]
             break;
          ++it;
       }
+      ctx.error = error_code::expected_quote;
    }
 
    template <char open, char close>
-   inline void skip_until_closed(auto&& it, auto&& end)
+   inline void skip_until_closed(auto&& ctx, auto&& it, auto&& end) noexcept
    {
       ++it;
       size_t open_count = 1;
       size_t close_count = 0;
-      while (it < end && open_count > close_count) {
-         switch (*it) {
-         case '/':
-            skip_comment(it, end);
-            break;
-         case '"':
-            skip_string(it, end);
-            break;
-         case open:
-            ++open_count;
-            ++it;
-            break;
-         case close:
-            ++close_count;
-            ++it;
-            break;
-         default:
-            ++it;
+      if constexpr (contiguous_iterator<decltype(it)>) {
+         // jump between structural characters rather than walking every byte
+         while (it < end && open_count > close_count) {
+            const auto [p, e] = to_pointers(it, end);
+            it += find_first_of<'/', '"', open, close>(p, e) - p;
+            if (it == end) [[unlikely]] {
+               break;
+            }
+            switch (*it) {
+            case '/':
+               skip_comment(ctx, it, end);
+               break;
+            case '"':
+               skip_string(ctx, it, end);
+               break;
+            case open:
+               ++open_count;
+               ++it;
+               break;
+            default: // close
+               ++close_count;
+               ++it;
+            }
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+         }
+      }
+      else if constexpr (windowed_iterator<decltype(it)>) {
+         while (it != end && open_count > close_count) {
+            const auto [p, e] = it.window();
+            const auto c = find_first_of<'/', '"', open, close>(p, e);
+            it.advance(static_cast<size_t>(c - p));
+            if (c == e) {
+               continue;
+            }
+            switch (*it) {
+            case '/':
+               skip_comment(ctx, it, end);
+               break;
+            case '"':
+               skip_string(ctx, it, end);
+               break;
+            case open:
+               ++open_count;
+               ++it;
+               break;
+            default: // close
+               ++close_count;
+               ++it;
+            }
+            if (bool(ctx.error)) [[unlikely]]
+               return;
+         }
+      }
+      else {
+         while (it != end && open_count > close_count) {
+            switch (*it) {
+            case '/':
+               skip_comment(ctx, it, end);
+               break;
+            case '"':
+               skip_string(ctx, it, end);
+               break;
+            case open:
+               ++open_count;
+               ++it;
+               break;
+            case close:
+               ++close_count;
+               ++it;
+               break;
+            default:
+               ++it;
+            }
+            if (bool(ctx.error)) [[unlikely]]
+               return;
          }
       }
+      
+      if (open_count > close_count) [[unlikely]] {
+         ctx.error = expected_error<close>();
+      }
    }
    
    inline constexpr bool is_numeric(const auto c) noexcept
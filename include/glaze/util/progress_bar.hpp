@@ -7,11 +7,8 @@
 #include <iostream>
 #include <string>
 
-#ifndef FMT_HEADER_ONLY
-#define FMT_HEADER_ONLY
-#endif  // !FMT_HEADER_ONLY
-#include "fmt/format.h"
-#include "fmt/compile.h"
+#include "glaze/util/dtoa.hpp"
+#include "glaze/util/itoa.hpp"
 
 namespace glz
 {
@@ -54,12 +51,25 @@ namespace glz
                        std::max(completed, one)));
          const auto minutes = eta_s / 60;
          const auto seconds = eta_s - minutes * 60;
-         fmt::format_to(std::back_inserter(s), FMT_COMPILE(" {}% | ETA: {}m {}s | {}/{}"),
-                        std::round(percentage),
-                        minutes,
-                        seconds,
-                        completed,
-                        total);
+         char chars[32];
+         const auto append = [&](const auto x) {
+            if constexpr (std::floating_point<decltype(x)>) {
+               s.append(chars, detail::dtoa(chars, x));
+            }
+            else {
+               s.append(chars, detail::itoa(chars, x));
+            }
+         };
+         s += ' ';
+         append(std::round(percentage));
+         s += "% | ETA: ";
+         append(minutes);
+         s += "m ";
+         append(seconds);
+         s += "s | ";
+         append(completed);
+         s += '/';
+         append(total);
          return s;
       }
    };
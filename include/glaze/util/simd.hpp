@@ -0,0 +1,143 @@
+// Glaze Library
+// For the license information refer to glaze.hpp
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+// Vectorized scanning over contiguous character buffers.
+// AVX2 is used when the target is compiled with it, otherwise SSE2 on x86, otherwise a scalar fallback.
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define GLZ_USE_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GLZ_USE_SSE2
+#endif
+
+namespace glz::detail
+{
+#if defined(GLZ_USE_AVX2)
+   inline constexpr size_t simd_width = 32;
+   using simd_t = __m256i;
+
+   inline simd_t simd_load(const char* p) noexcept {
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+   }
+
+   inline simd_t simd_set(const char c) noexcept { return _mm256_set1_epi8(c); }
+
+   inline simd_t simd_zero() noexcept { return _mm256_setzero_si256(); }
+
+   inline simd_t simd_eq(const simd_t a, const simd_t b) noexcept { return _mm256_cmpeq_epi8(a, b); }
+
+   inline simd_t simd_or(const simd_t a, const simd_t b) noexcept { return _mm256_or_si256(a, b); }
+
+   // bytes greater than or equal to c (unsigned comparison)
+   inline simd_t simd_ge(const simd_t a, const simd_t c) noexcept { return _mm256_cmpeq_epi8(_mm256_max_epu8(a, c), a); }
+
+   inline uint32_t simd_mask(const simd_t a) noexcept { return static_cast<uint32_t>(_mm256_movemask_epi8(a)); }
+
+   inline constexpr uint32_t simd_full_mask = 0xFFFFFFFF;
+#elif defined(GLZ_USE_SSE2)
+   inline constexpr size_t simd_width = 16;
+   using simd_t = __m128i;
+
+   inline simd_t simd_load(const char* p) noexcept {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+   }
+
+   inline simd_t simd_set(const char c) noexcept { return _mm_set1_epi8(c); }
+
+   inline simd_t simd_zero() noexcept { return _mm_setzero_si128(); }
+
+   inline simd_t simd_eq(const simd_t a, const simd_t b) noexcept { return _mm_cmpeq_epi8(a, b); }
+
+   inline simd_t simd_or(const simd_t a, const simd_t b) noexcept { return _mm_or_si128(a, b); }
+
+   inline simd_t simd_ge(const simd_t a, const simd_t c) noexcept { return _mm_cmpeq_epi8(_mm_max_epu8(a, c), a); }
+
+   inline uint32_t simd_mask(const simd_t a) noexcept { return static_cast<uint32_t>(_mm_movemask_epi8(a)); }
+
+   inline constexpr uint32_t simd_full_mask = 0xFFFF;
+#endif
+
+   // returns a pointer to the first character greater than a space (or end)
+   inline const char* skip_ws_simd(const char* it, const char* end) noexcept
+   {
+      // pretty printed JSON mostly has short whitespace runs, so check the first character before loading a block
+      if (it == end || static_cast<uint8_t>(*it) > 32) {
+         return it;
+      }
+#if defined(GLZ_USE_AVX2) || defined(GLZ_USE_SSE2)
+      const auto not_ws = simd_set(33);
+      while (static_cast<size_t>(end - it) >= simd_width) {
+         const auto mask = simd_mask(simd_ge(simd_load(it), not_ws));
+         if (mask) {
+            return it + std::countr_zero(mask);
+         }
+         it += simd_width;
+      }
+#endif
+      while (it < end && static_cast<uint8_t>(*it) < 33) {
+         ++it;
+      }
+      return it;
+   }
+
+   // returns a pointer to the first occurance of any of the characters Cs (or end)
+   template <char... Cs>
+   inline const char* find_first_of(const char* it, const char* end) noexcept
+   {
+#if defined(GLZ_USE_AVX2) || defined(GLZ_USE_SSE2)
+      while (static_cast<size_t>(end - it) >= simd_width) {
+         const auto chunk = simd_load(it);
+         simd_t match = simd_zero();
+         ((match = simd_or(match, simd_eq(chunk, simd_set(Cs)))), ...);
+         const auto mask = simd_mask(match);
+         if (mask) {
+            return it + std::countr_zero(mask);
+         }
+         it += simd_width;
+      }
+#endif
+      while (it < end) {
+         const auto c = *it;
+         if (((c == Cs) || ...)) {
+            return it;
+         }
+         ++it;
+      }
+      return it;
+   }
+
+   // returns a pointer to the first quote, backslash or control character (below a space) in a JSON string (or end)
+   inline const char* find_string_special(const char* it, const char* end) noexcept
+   {
+#if defined(GLZ_USE_AVX2) || defined(GLZ_USE_SSE2)
+      const auto quote = simd_set('"');
+      const auto backslash = simd_set('\\');
+      const auto space = simd_set(' ');
+      while (static_cast<size_t>(end - it) >= simd_width) {
+         const auto chunk = simd_load(it);
+         const auto escaped = simd_mask(simd_or(simd_eq(chunk, quote), simd_eq(chunk, backslash)));
+         const auto control = ~simd_mask(simd_ge(chunk, space)) & simd_full_mask;
+         if (const auto mask = escaped | control) {
+            return it + std::countr_zero(mask);
+         }
+         it += simd_width;
+      }
+#endif
+      while (it < end) {
+         const auto c = *it;
+         if (c == '"' || c == '\\' || static_cast<uint8_t>(c) < 0x20) {
+            return it;
+         }
+         ++it;
+      }
+      return it;
+   }
+}
@@ -6,11 +6,7 @@
 #include <string>
 #include <optional>
 
-#ifndef FMT_HEADER_ONLY
-#define FMT_HEADER_ONLY
-#endif  // !FMT_HEADER_ONLY
-#include "fmt/format.h"
-#include "fmt/compile.h"
+#include "glaze/util/itoa.hpp"
 
 namespace glz
 {
@@ -51,15 +47,23 @@ namespace glz
                                                const sv filename = "")
       {
          std::string s{};
-         auto it = std::back_inserter(s);
+         char chars[24];
          
          if (!filename.empty()) {
-            fmt::format_to(it, FMT_COMPILE("{}:"), filename);
+            s.append(filename);
+            s += ':';
          }
          
-         fmt::format_to(it, FMT_COMPILE("{}:{}: {}\n"), info.line, info.column, error);
-         fmt::format_to(it, FMT_COMPILE("   {}\n   "), info.context);
-         fmt::format_to(it, FMT_COMPILE("{: <{}}^\n"), "", info.column - 1);
+         s.append(chars, itoa(chars, info.line));
+         s += ':';
+         s.append(chars, itoa(chars, info.column));
+         s += ": ";
+         s.append(error);
+         s += "\n   ";
+         s.append(info.context);
+         s += "\n   ";
+         s.append(info.column > 0 ? info.column - 1 : 0, ' ');
+         s += "^\n";
          return s;
       }
    }  // namespace detail
@@ -430,6 +430,40 @@ suite binary_helpers = [] {
          v = glz::read_binary<my_struct>(binary);
       }));
    };
+
+   "truncated string"_test = [] {
+      auto binary = glz::write_binary(std::string{"Hello World"});
+      binary.resize(binary.size() - 3);
+      std::string s{};
+      glz::context ctx{};
+      expect(glz::read<glz::opts{.format = glz::binary}>(s, binary, ctx) == glz::error_code::missing_binary_data);
+      expect(s.empty());
+   };
+};
+
+suite binary_variant = [] {
+   "binary variant"_test = [] {
+      using value_t = std::variant<std::monostate, int32_t, std::string, my_struct>;
+      std::vector<value_t> v{std::monostate{}, 7, std::string{"seven"}, my_struct{}};
+      std::get<my_struct>(v[3]).d = 7.5;
+      const auto binary = glz::write_binary(v);
+
+      std::vector<value_t> result{};
+      glz::read_binary(result, binary);
+      expect(result.size() == 4);
+      expect(std::holds_alternative<std::monostate>(result[0]));
+      expect(std::get<int32_t>(result[1]) == 7);
+      expect(std::get<std::string>(result[2]) == "seven");
+      expect(std::get<my_struct>(result[3]).d == 7.5);
+
+      // the alternative index is a one byte compressed integer
+      expect(glz::write_binary(value_t{int32_t{7}}).size() == 1 + sizeof(int32_t));
+
+      std::string bad = glz::write_binary(value_t{});
+      bad[0] = static_cast<char>(9 << 2);
+      value_t out{};
+      expect(throws([&] { glz::read_binary(out, bad); }));
+   };
 };
 
 int main()
@@ -8,8 +8,16 @@
 #include <forward_list>
 #include <unordered_map>
 #include <map>
+#include <memory_resource>
 #include <list>
 #include <deque>
+#include <fstream>
+#include <sstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 #include "boost/ut.hpp"
 #include "glaze/json/json_ptr.hpp"
@@ -17,6 +25,8 @@
 #include "glaze/json/read.hpp"
 #include "glaze/json/write.hpp"
 #include "glaze/json/prettify.hpp"
+#include "glaze/json/read_parallel.hpp"
+#include "glaze/json/ndjson.hpp"
 #include "glaze/util/progress_bar.hpp"
 #include "glaze/api/impl.hpp"
 
@@ -246,6 +256,59 @@ void basic_types() {
       expect(num == 10000);
    };
 
+   "int read 64 bit"_test = [] {
+      uint64_t u{};
+      glz::read_json(u, "18446744073709551615");
+      expect(u == 18446744073709551615ULL);
+      glz::read_json(u, "9007199254740993");
+      expect(u == 9007199254740993ULL);
+      expect(throws([&] { glz::read_json(u, "18446744073709551616"); }));
+      expect(throws([&] { glz::read_json(u, "-1"); }));
+
+      int64_t i{};
+      glz::read_json(i, "-9223372036854775808");
+      expect(i == std::numeric_limits<int64_t>::min());
+      glz::read_json(i, "1234567890123456789");
+      expect(i == 1234567890123456789);
+      expect(throws([&] { glz::read_json(i, "9223372036854775808"); }));
+
+      int8_t small{};
+      glz::read_json(small, "-128");
+      expect(small == -128);
+      expect(throws([&] { glz::read_json(small, "128"); }));
+      expect(throws([&] { glz::read_json(small, "1e3"); }));
+   };
+
+   "int read non-contiguous"_test = [] {
+      std::vector<int64_t> v{};
+      const std::string_view s = "[-9223372036854775808, 42, 1.5e2]";
+      glz::read_json(v, std::deque<char>{s.begin(), s.end()});
+      expect(v == std::vector<int64_t>{std::numeric_limits<int64_t>::min(), 42, 150});
+   };
+
+   "int read zeros"_test = [] {
+      uint32_t u{7};
+      glz::read_json(u, "-0");
+      expect(u == 0);
+      int i{7};
+      glz::read_json(i, "0");
+      expect(i == 0);
+      glz::read_json(i, "-0");
+      expect(i == 0);
+      glz::read_json(i, "0.5e1");
+      expect(i == 5);
+      expect(throws([&] { glz::read_json(u, "01"); }));
+      expect(throws([&] { glz::read_json(i, "-007"); }));
+      expect(throws([&] { glz::read_json(i, "00"); }));
+
+      std::vector<uint64_t> v{};
+      const std::string_view zeros = "[0, -0, 10]";
+      glz::read_json(v, std::deque<char>{zeros.begin(), zeros.end()});
+      expect(v == std::vector<uint64_t>{0, 0, 10});
+      const std::string_view leading = "[1, 01]";
+      expect(throws([&] { glz::read_json(v, std::deque<char>{leading.begin(), leading.end()}); }));
+   };
+
    "bool write"_test = [] {
       std::string buffer{};
       glz::write_json(true, buffer);
@@ -465,6 +528,18 @@ void enum_types()
       glz::write_json(color, buffer);
       expect(buffer == "\"Green\"");
    };
+
+   "unknown enum"_test = [] {
+      Color color{};
+      glz::context ctx{};
+      const std::string buffer = R"([ "Purple"])";
+      std::vector<Color> colors{};
+      const auto pe = glz::read_json(colors, buffer, ctx);
+      expect(pe == glz::error_code::unexpected_enum);
+      expect(pe.location == 2);
+      expect(glz::format_error(pe, buffer).find("^") != std::string::npos);
+      expect(throws([&] { glz::read_json(color, std::string{"\"Purple\""}); }));
+   };
 }
 
 void user_types() {
@@ -1228,9 +1303,8 @@ void read_tests() {
       std::string in =
          R"("asljl{}121231212441[]123::,,;,;,,::,Q~123\a13dqwdwqwq")";
       std::string res{};
-      glz::read_json(res, in);
-//*   function fails, does not recognize '\'
-      //expect(res == "asljl{}121231212441[]123::,,;,;,,::,Q~123\\a13dqwdwqwq");
+      // \a is not a JSON escape
+      expect(throws([&] { glz::read_json(res, in); }));
    };
 
    "Nested array"_test = [] {
@@ -1664,6 +1738,32 @@ suite error_outputs = [] {
                 "1:17: Expected:,\n   {\"Hello\":\"World\"x, \"color\": \"red\"}\n                   ^\n");
       }
    };
+
+   "error_code"_test = [] {
+      std::string s = R"({"Hello":"World"x, "color": "red"})";
+      std::map<std::string, std::string> m;
+      glz::context ctx{};
+      const auto pe = glz::read_json(m, s, ctx);
+      expect(pe == glz::error_code::expected_comma);
+      expect(pe.location == 16);
+      expect(glz::format_error(pe, s) ==
+             "1:17: Expected:,\n   {\"Hello\":\"World\"x, \"color\": \"red\"}\n                   ^\n");
+   };
+
+   "error_code nested"_test = [] {
+      my_struct obj{};
+      glz::context ctx{};
+      auto pe = glz::read_json(obj, std::string{R"({"d":1.5,"arr":[1,2,x]})"}, ctx);
+      expect(pe == glz::error_code::parse_number_failure);
+      expect(pe.location == 20);
+
+      pe = glz::read_json(obj, std::string{R"({"d":2.5,"hello":"unterminated)"}, ctx);
+      expect(pe == glz::error_code::expected_quote);
+
+      pe = glz::read_json(obj, std::string{R"({"d":3.5})"}, ctx);
+      expect(!pe);
+      expect(obj.d == 3.5);
+   };
 };
 
 #include "glaze/json/study.hpp"
@@ -1779,6 +1879,1025 @@ suite raw_json_tests = [] {
          glz::read_json(v, s);
       }));
    };
+
+   "raw_json_view"_test = [] {
+      const std::string s = R"({"id": 5, "payload": {"a":[1, "}"]}, "list" : [ true ,null ]})";
+      std::map<std::string, glz::raw_json_view> m{};
+      glz::read_json(m, s);
+      expect(m["id"].str == "5");
+      expect(m["payload"].str == R"({"a":[1, "}"]})");
+      expect(m["list"].str == "[ true ,null ]");
+      expect(m["payload"].str.data() > s.data() && m["payload"].str.data() < s.data() + s.size());
+      expect(glz::write_json(m) == R"({"id":5,"list":[ true ,null ],"payload":{"a":[1, "}"]}})");
+   };
+};
+
+suite vectorized_scanning = [] {
+   "pretty whitespace"_test = [] {
+      std::string buffer = R"({
+                                          "i":                                    42,
+         "unknown":   {  "nested": [ "a long string value with a } and a ] inside of it",
+                               { "escaped \" quote": "\\" } ] },
+                                          "hello":       "a string that is longer than a single vector register width",
+      "arr"  :  [    1   ,
+                         2 ,     3 ]
+                                 })";
+      my_struct s{};
+      glz::read_json(s, buffer);
+      expect(s.d == 3.14);
+      expect(s.hello == "a string that is longer than a single vector register width");
+      expect(s.arr == std::array<uint64_t, 3>{1, 2, 3});
+   };
+   
+   "long escaped string"_test = [] {
+      std::string expected(100, 'x');
+      expected += "\"";
+      expected += std::string(40, 'y');
+      expected += '\\';
+      std::string buffer{};
+      glz::write_json(expected, buffer);
+      std::string s{};
+      glz::read_json(s, buffer);
+      expect(s == expected);
+      
+      buffer.pop_back();
+      expect(throws([&] { glz::read_json(s, buffer); }));
+   };
+};
+
+suite structural_index = [] {
+   static constexpr glz::opts indexed{.structural_index = true};
+
+   "sparse schema"_test = [] {
+      std::string buffer = R"({"skip0":{"a":[1,2,{"b":"}]"}]},"d":7.5,"skip1":[[],{},"\"[",[{"c":{}}]],)"
+                           R"("hello":"world","skip2":{"d":"\\"},"arr":[4,5,6],"skip3":[{"e":"{"}]})";
+      my_struct s{};
+      glz::read<indexed>(s, buffer);
+      expect(s.d == 7.5);
+      expect(s.hello == "world");
+      expect(s.arr == std::array<uint64_t, 3>{4, 5, 6});
+   };
+
+   "raw_json"_test = [] {
+      std::vector<glz::raw_json> v{};
+      glz::read<indexed>(v, std::string{R"([{"a":[1,"]"]},[2,{}],3])"});
+      expect(v.size() == 3);
+      expect(v[0].str == R"({"a":[1,"]"]})");
+      expect(v[1].str == R"([2,{}])");
+      expect(v[2].str == "3");
+   };
+
+   "array of records"_test = [] {
+      // the index is built inside the first record and must cover the records after it
+      std::string buffer = R"([{"skip":{"a":[1]},"d":1.5},{"skip":{"a":[2]},"d":2.5},{"skip":[3],"d":3.5}])";
+      std::vector<my_struct> v{};
+      glz::context ctx{};
+      expect(!glz::read<indexed>(v, buffer, ctx));
+      expect(v.size() == 3);
+      expect(v[2].d == 3.5);
+      expect(ctx.index == nullptr); // the index is not kept past the read
+
+      glz::detail::structural_index index{};
+      const auto first_skip = buffer.find('{', 2);
+      index.build(buffer.data() + first_skip, buffer.data() + buffer.size());
+      expect(index.valid);
+      expect(index.opens.size() == 7);
+      const auto last_skip = buffer.rfind('[');
+      expect(index.find_close(buffer.data() + last_skip) == buffer.data() + last_skip + 2);
+   };
+
+   "reused context"_test = [] {
+      // the same buffer address with different contents must not use the index of the previous read
+      std::string buffer = R"({"skip":[[1],[2]],"d":1.5})";
+      my_struct s{};
+      glz::context ctx{};
+      expect(!glz::read<indexed>(s, buffer, ctx));
+      expect(s.d == 1.5);
+      buffer = R"({"skip":[1],"d":2.5})";
+      expect(!glz::read<indexed>(s, buffer, ctx));
+      expect(s.d == 2.5);
+   };
+
+   "comments fall back"_test = [] {
+      std::string buffer = R"({"skip":{/*}*/"a":1},"d":9.5})";
+      my_struct s{};
+      glz::read<glz::opts{.comments = true, .structural_index = true}>(s, buffer);
+      expect(s.d == 9.5);
+   };
+
+   "unterminated"_test = [] {
+      std::string buffer = R"({"skip":{"a":[1,2],"d":1})";
+      my_struct s{};
+      expect(throws([&] { glz::read<indexed>(s, buffer); }));
+   };
+};
+
+suite key_order = [] {
+   "declaration order"_test = [] {
+      my_struct s{};
+      glz::read_json(s, std::string{R"({"i":1,"d":2.5,"hello":"a","arr":[7,8,9]})"});
+      expect(s.d == 2.5);
+      expect(s.hello == "a");
+      expect(s.arr == std::array<uint64_t, 3>{7, 8, 9});
+   };
+
+   "shuffled and prefixed keys"_test = [] {
+      my_struct s{};
+      glz::read_json(s, std::string{R"({"arr":[4,5,6], "hello" : "b","hellox":"c","d":-2.5,"\u0064":-1.5})"});
+      expect(s.d == -1.5);
+      expect(s.hello == "b");
+      expect(s.arr == std::array<uint64_t, 3>{4, 5, 6});
+   };
+};
+
+suite map_keys = [] {
+   "transparent map"_test = [] {
+      std::map<std::string, int, std::less<>> m{{"b", 1}};
+      glz::read_json(m, std::string{R"({"a":1,"b":2,"c\"d":3})"});
+      expect(m.size() == 3);
+      expect(m["b"] == 2);
+      expect(m["c\"d"] == 3);
+   };
+
+   "unsorted map"_test = [] {
+      std::map<std::string, int> m{};
+      glz::read_json(m, std::string{R"({"x":1, "a" :2,"y":3,"x":4})"});
+      expect(m.size() == 3);
+      expect(m["a"] == 2);
+      expect(m["x"] == 4);
+   };
+
+   "unordered map"_test = [] {
+      std::unordered_map<std::string, double> m{};
+      glz::read_json(m, std::string{R"({"pi":3.5,"e":2.5})"});
+      expect(m.size() == 2);
+      expect(m["e"] == 2.5);
+   };
+
+   "numeric keys"_test = [] {
+      std::map<int, std::string> m{};
+      glz::read_json(m, std::string{R"({"-3":"a", "10" : "b"})"});
+      expect(m.size() == 2);
+      expect(m[-3] == "a");
+      expect(m[10] == "b");
+      expect(throws([&] { glz::read_json(m, std::string{R"({"4x":"c"})"}); }));
+   };
+};
+
+struct request_view
+{
+   std::string_view method{};
+   std::string_view path{};
+   std::map<std::string_view, std::string_view> headers{};
+};
+
+template <>
+struct glz::meta<request_view>
+{
+   using T = request_view;
+   static constexpr auto value = object("method", &T::method, "path", &T::path, "headers", &T::headers);
+};
+
+suite string_view_reading = [] {
+   "string_view members"_test = [] {
+      std::string buffer = R"({"method":"GET","path":"/a\"b\\c","headers":{"host":"x","k\"y":"v\/w"}})";
+      request_view r{};
+      glz::read_json(r, buffer);
+      expect(r.method == "GET");
+      expect(r.path == R"(/a"b\c)");
+      expect(r.headers.size() == 2);
+      expect(r.headers["host"] == "x");
+      expect(r.headers["k\"y"] == "v/w");
+
+      // unescaped strings point into the buffer
+      expect(r.method.data() > buffer.data() && r.method.data() < buffer.data() + buffer.size());
+   };
+
+   "string_view decoded in place"_test = [] {
+      std::string buffer = R"(["a\"b", "\u00e9\n"] )";
+      std::vector<std::string_view> v{};
+      glz::read_json(v, buffer);
+      expect(v == std::vector<std::string_view>{"a\"b", "\xc3\xa9\n"});
+      // the bytes freed by the escapes are whitespace, the closing quote follows the decoded string
+      expect(buffer == "[\"a\"b\" , \"\xc3\xa9\n\"     ] ");
+   };
+
+   "string_view read-only buffer"_test = [] {
+      std::string_view value{};
+      glz::context ctx{};
+      expect(!glz::read_json(value, std::string_view{R"("plain")"}, ctx));
+      expect(value == "plain");
+      const auto pe = glz::read_json(value, std::string_view{R"("esc\"aped")"}, ctx);
+      expect(pe == glz::error_code::escaped_string_view);
+   };
+};
+
+struct arena_nodes
+{
+   std::shared_ptr<std::pmr::vector<int>> shared{};
+   glz::pmr_unique_ptr<std::pmr::string> unique{};
+};
+
+template <>
+struct glz::meta<arena_nodes>
+{
+   using T = arena_nodes;
+   static constexpr auto value = object("shared", &T::shared, "unique", &T::unique);
+};
+
+suite pmr_reading = [] {
+   "pmr containers"_test = [] {
+      std::array<std::byte, 4096> storage{};
+      std::pmr::monotonic_buffer_resource arena{storage.data(), storage.size(), std::pmr::null_memory_resource()};
+      const auto in_arena = [&](const void* p) {
+         return p >= storage.data() && p < storage.data() + storage.size();
+      };
+
+      std::pmr::map<std::pmr::string, std::pmr::vector<std::pmr::string>, std::less<>> m{&arena};
+      glz::read_json(m, std::string{R"({"a long key that is not inlined":["a long string that is not inlined"]})"});
+      expect(m.size() == 1);
+      const auto& [key, strings] = *m.begin();
+      expect(in_arena(key.data()));
+      expect(strings.size() == 1);
+      expect(in_arena(strings[0].data()));
+      expect(strings[0] == "a long string that is not inlined");
+   };
+
+   "pmr nullable pointers"_test = [] {
+      std::array<std::byte, 4096> storage{};
+      std::pmr::monotonic_buffer_resource arena{storage.data(), storage.size(), std::pmr::null_memory_resource()};
+      const auto in_arena = [&](const void* p) {
+         return p >= storage.data() && p < storage.data() + storage.size();
+      };
+
+      arena_nodes nodes{};
+      glz::context ctx{.resource = &arena};
+      expect(!glz::read_json(nodes, std::string{R"({"shared":[1,2,3],"unique":"a long string that is not inlined"})"}, ctx));
+      expect(in_arena(nodes.shared.get()));
+      expect(in_arena(nodes.shared->data()));
+      expect(*nodes.shared == std::pmr::vector<int>{1, 2, 3});
+      expect(in_arena(nodes.unique.get()));
+      expect(in_arena(nodes.unique->data()));
+      expect(*nodes.unique == "a long string that is not inlined");
+      expect(glz::write_json(nodes) == R"({"shared":[1,2,3],"unique":"a long string that is not inlined"})");
+
+      arena_nodes heap{};
+      glz::read_json(heap, std::string{R"({"shared":[4],"unique":"x"})"});
+      expect(!in_arena(heap.shared.get()) && !in_arena(heap.unique.get()));
+   };
+};
+
+suite parallel_reading = [] {
+   "parallel array"_test = [] {
+      std::vector<std::map<std::string, std::vector<std::string>>> v(2000);
+      for (size_t i = 0; i < v.size(); ++i) {
+         v[i]["k,]"] = {std::to_string(i), "\"[{,", "x"};
+      }
+      const auto buffer = glz::write_json(v);
+
+      glz::pool workers{4};
+      std::vector<std::map<std::string, std::vector<std::string>>> result{};
+      glz::read_json_parallel(result, buffer, workers);
+      expect(result == v);
+
+      std::vector<int> ints{};
+      glz::read_json_parallel(ints, std::string{" [ ] "}, workers);
+      expect(ints.empty());
+      glz::read_json_parallel(ints, std::string{"[1, 2 ,3]"}, workers);
+      expect(ints == std::vector<int>{1, 2, 3});
+      glz::read_json_parallel(ints, std::string{"[4,/*c*/5]"}, workers);
+      expect(ints == std::vector<int>{4, 5});
+   };
+
+   "parallel indexed records"_test = [] {
+      std::string buffer = "[";
+      for (size_t i = 0; i < 1000; ++i) {
+         buffer += R"({"skip":{"a":[1,{"b":"]"}]},"d":)" + std::to_string(i) + R"(,"more":[[],{}]},)";
+      }
+      buffer.back() = ']';
+      glz::pool workers{4};
+      std::vector<my_struct> v{};
+      glz::read_json_parallel<glz::opts{.structural_index = true}>(v, buffer, workers);
+      expect(v.size() == 1000);
+      expect(v[999].d == 999.0);
+   };
+
+   "parallel array errors"_test = [] {
+      glz::pool workers{2};
+      std::vector<int> ints{};
+      glz::context ctx{};
+      auto pe = glz::read_json_parallel(ints, std::string{"[1,2,x,4,y]"}, workers, ctx);
+      expect(pe == glz::error_code::parse_number_failure);
+      expect(pe.location == 5);
+      pe = glz::read_json_parallel(ints, std::string{"[1,2 3,4]"}, workers, ctx);
+      expect(pe == glz::error_code::expected_comma);
+      expect(bool(glz::read_json_parallel(ints, std::string{"[1,2"}, workers, ctx)));
+      expect(bool(glz::read_json_parallel(ints, std::string{"{}"}, workers, ctx)));
+      expect(throws([&] { glz::read_json_parallel(ints, std::string{"[1,}"}, workers); }));
+   };
+
+   "vector of bool"_test = [] {
+      glz::pool workers{4};
+      std::vector<bool> expected(1000);
+      for (size_t i = 0; i < expected.size(); ++i) {
+         expected[i] = (i % 3) == 0;
+      }
+      std::vector<bool> bits{};
+      glz::read_json_parallel(bits, glz::write_json(expected), workers);
+      expect(bits == expected);
+   };
+};
+
+suite ndjson = [] {
+   "ndjson round trip"_test = [] {
+      std::vector<std::map<std::string, std::vector<int>>> records(3000);
+      for (size_t i = 0; i < records.size(); ++i) {
+         records[i]["id"] = {int(i), int(i) * 2};
+         records[i]["q\"uote"] = {};
+      }
+      const auto buffer = glz::write_ndjson(records);
+      expect(buffer.starts_with("{\"id\":[0,0],\"q\\\"uote\":[]}\n"));
+
+      glz::ndjson_reader<std::map<std::string, std::vector<int>>> reader{buffer};
+      size_t i = 0;
+      for (auto& record : reader) {
+         expect(record == records[i]);
+         ++i;
+      }
+      expect(i == records.size());
+      expect(!reader.last_error());
+
+      // the stream crosses several blocks
+      std::stringstream ss{buffer};
+      glz::ndjson_reader<std::map<std::string, std::vector<int>>> stream_reader{ss};
+      i = 0;
+      while (stream_reader.next()) {
+         expect(stream_reader.value == records[i]);
+         ++i;
+      }
+      expect(i == records.size());
+   };
+
+   "ndjson lines"_test = [] {
+      const std::string buffer = "[1]\r\n\n  \n[2,3]\n[4] [5]\n[6]";
+      glz::ndjson_reader<std::vector<int>> reader{buffer};
+      expect(reader.next() && reader.value == std::vector<int>{1});
+      expect(reader.next() && reader.value == std::vector<int>{2, 3});
+      expect(!reader.next());
+      expect(reader.last_error() == glz::error_code::syntax_error);
+      expect(reader.last_error().location == 19);
+      expect(!reader.next());
+   };
+
+   "ndjson stream without a final newline"_test = [] {
+      std::stringstream ss{"[1]\n[2,3,4,5,6,7,8]"};
+      glz::ndjson_reader<std::vector<int>> reader{ss};
+      expect(reader.next() && reader.value == std::vector<int>{1});
+      expect(reader.next() && reader.value == std::vector<int>{2, 3, 4, 5, 6, 7, 8});
+      expect(!reader.next());
+      expect(!reader.last_error());
+   };
+
+   "ndjson writer"_test = [] {
+      glz::ndjson_writer writer{};
+      writer.append(my_struct{});
+      writer.append(std::vector<int>{1, 2});
+      expect(writer.view() == R"({"i":287,"d":3.14,"hello":"Hello World","arr":[1,2,3]})" "\n[1,2]\n");
+      writer.clear();
+      writer.append_range(std::vector<bool>{true, false});
+      expect(writer.take() == "true\nfalse\n");
+      expect(writer.view().empty());
+   };
+};
+
+suite minified_reading = [] {
+   "minified"_test = [] {
+      my_struct v{};
+      v.d = 2.5;
+      v.hello = "a\"b";
+      v.arr = {7, 8, 9};
+      const auto json = glz::write_json(v);
+      my_struct result{};
+      glz::read<glz::opts{.minified = true}>(result, json);
+      expect(result.d == 2.5);
+      expect(result.hello == "a\"b");
+      expect(result.arr == std::array<uint64_t, 3>{7, 8, 9});
+
+      std::map<std::string, std::vector<std::optional<int>>> m{{"a", {1, std::nullopt}}, {"b", {}}};
+      decltype(m) m2{};
+      glz::read<glz::opts{.minified = true}>(m2, glz::write_json(m));
+      expect(m2 == m);
+   };
+};
+
+struct partial_inner
+{
+   int c{};
+   int d{};
+};
+
+template <>
+struct glz::meta<partial_inner>
+{
+   using T = partial_inner;
+   static constexpr auto value = object("c", &T::c, "d", &T::d);
+};
+
+struct partial_outer
+{
+   int a{};
+   partial_inner b{};
+   std::string z{};
+};
+
+template <>
+struct glz::meta<partial_outer>
+{
+   using T = partial_outer;
+   static constexpr auto value = object("a", &T::a, "b", &T::b, "z", &T::z);
+};
+
+suite partial_read = [] {
+   "partial read"_test = [] {
+      Thing src{};
+      src.thing.b = "partial";
+      src.i = 42;
+      src.d = 1.5;
+      src.map["f"] = 9;
+      src.vec3.x = 11.0;
+      const auto buffer = glz::write_json(src);
+
+      static constexpr auto partial = glz::json_ptrs("/thing/b", "/i", "/map/f", "/d");
+      Thing dst{};
+      glz::read_json<partial>(dst, buffer);
+      expect(dst.thing.b == "partial");
+      expect(dst.i == 42);
+      expect(dst.d == 1.5);
+      expect(dst.map["f"] == 9);
+      expect(dst.vec3.x != 11.0);
+   };
+
+   "partial read stops early"_test = [] {
+      // nothing after the last requested value is scanned, so the malformed tail is never seen
+      const std::string buffer = R"({"unknown":{"x":[1,"]"]},"b":{"d":3,"c":2},"a":1,"z":oops)";
+      static constexpr auto partial = glz::json_ptrs("/a", "/b/c");
+      partial_outer v{};
+      glz::context ctx{};
+      expect(!glz::read_json<partial>(v, buffer, ctx));
+      expect(v.a == 1);
+      expect(v.b.c == 2);
+      expect(v.b.d == 0);
+      expect(throws([&] { glz::read_json(v, buffer); }));
+
+      static constexpr auto all = glz::json_ptrs("/a", "/b/c", "/z");
+      expect(throws([&] { glz::read_json<all>(v, buffer); }));
+
+      // missing values leave the target unchanged
+      partial_outer w{};
+      expect(!glz::read_json<all>(w, std::string{R"({"b":{"c":5}})"}, ctx));
+      expect(w.b.c == 5);
+   };
+};
+
+struct circle
+{
+   double radius{};
+};
+
+template <>
+struct glz::meta<circle>
+{
+   using T = circle;
+   static constexpr auto value = object("radius", &T::radius);
+};
+
+struct square
+{
+   double side{};
+   std::string label{};
+};
+
+template <>
+struct glz::meta<square>
+{
+   using T = square;
+   static constexpr auto value = object("side", &T::side, "label", &T::label);
+};
+
+using shape = std::variant<circle, square>;
+
+template <>
+struct glz::meta<shape>
+{
+   static constexpr std::string_view tag = "type";
+   static constexpr std::array ids{"circle", "square"};
+};
+
+using shape_or_map = std::variant<circle, square, std::map<std::string, std::string>>;
+
+template <>
+struct glz::meta<shape_or_map>
+{
+   static constexpr std::string_view tag = "type";
+   static constexpr std::array ids{"circle", "square", "map"};
+};
+
+suite variant_reading = [] {
+   "tagged variant"_test = [] {
+      std::vector<shape> shapes{circle{1.5}, square{2.0, "box"}};
+      const auto buffer = glz::write_json(shapes);
+      expect(buffer == R"([{"type":"circle","radius":1.5},{"type":"square","side":2,"label":"box"}])");
+
+      std::vector<shape> result{};
+      glz::read_json(result, buffer);
+      expect(std::get<circle>(result[0]).radius == 1.5);
+      expect(std::get<square>(result[1]).label == "box");
+   };
+
+   "tag after other members"_test = [] {
+      shape s{};
+      glz::read_json(s, std::string{R"({ "side" : 3, "label" : "late", "type" : "square" })"});
+      expect(std::get<square>(s).side == 3.0);
+      expect(std::get<square>(s).label == "late");
+
+      std::stringstream ss{R"({"radius":4,"type":"circle"})"};
+      glz::read_json(s, ss);
+      expect(std::get<circle>(s).radius == 4.0);
+   };
+
+   "tagged variant with a map"_test = [] {
+      using map_t = std::map<std::string, std::string>;
+      std::vector<shape_or_map> values{circle{1.5}, map_t{{"a", "x"}, {"type", "circle"}}, map_t{},
+                                       square{2.0, "box"}};
+      const auto buffer = glz::write_json(values);
+      expect(buffer == R"([{"type":"circle","radius":1.5},{"type":"map","a":"x","type":"circle"},{"type":"map"},)"
+                       R"({"type":"square","side":2,"label":"box"}])");
+
+      std::vector<shape_or_map> result{};
+      glz::read_json(result, buffer);
+      expect(result.size() == 4);
+      expect(std::get<circle>(result[0]).radius == 1.5);
+      expect(std::get<map_t>(result[1]) == map_t{{"a", "x"}, {"type", "circle"}});
+      expect(std::get<map_t>(result[2]).empty());
+      expect(std::get<square>(result[3]).label == "box");
+
+      // objects from elsewhere: the tag later in the object, no tag, or a tag naming no alternative
+      const auto read = [](const std::string& json) {
+         shape_or_map s{};
+         glz::read_json(s, json);
+         return std::get<map_t>(s);
+      };
+      expect(read(R"({"a":"x","type":"map"})") == map_t{{"a", "x"}});
+      expect(read(R"({"a":"y"})") == map_t{{"a", "y"}});
+      expect(read(R"({"type":"other"})") == map_t{{"type", "other"}});
+   };
+
+   "variant errors"_test = [] {
+      shape s{};
+      glz::context ctx{};
+      expect(glz::read_json(s, std::string{R"({"type":"triangle"})"}, ctx) == glz::error_code::no_matching_variant_type);
+      expect(glz::read_json(s, std::string{R"({"radius":1})"}, ctx) == glz::error_code::no_matching_variant_type);
+   };
+
+   "deduced variant"_test = [] {
+      using value_t = std::variant<std::monostate, bool, int64_t, double, std::string, std::vector<int>, my_struct>;
+      std::vector<value_t> v{};
+      glz::read_json(v, std::string{R"([null,true,-42,2.5e1,"text",[1,2],{"d":1.25}])"});
+      expect(v.size() == 7);
+      expect(std::holds_alternative<std::monostate>(v[0]));
+      expect(std::get<bool>(v[1]));
+      expect(std::get<int64_t>(v[2]) == -42);
+      expect(std::get<double>(v[3]) == 25.0);
+      expect(std::get<std::string>(v[4]) == "text");
+      expect(std::get<std::vector<int>>(v[5]) == std::vector<int>{1, 2});
+      expect(std::get<my_struct>(v[6]).d == 1.25);
+
+      v.pop_back();
+      expect(glz::write_json(v) == R"([null,true,-42,25,"text",[1,2]])");
+
+      std::variant<int, std::string> no_bool{};
+      glz::context ctx{};
+      expect(glz::read_json(no_bool, std::string{"true"}, ctx) == glz::error_code::no_matching_variant_type);
+   };
+};
+
+struct similar_keys
+{
+   int ab{};
+   int ba{};
+   int abc{};
+   int cba{};
+   int abab{};
+   int baba{};
+};
+
+template <>
+struct glz::meta<similar_keys>
+{
+   using T = similar_keys;
+   static constexpr auto value =
+      object("ab", &T::ab, "ba", &T::ba, "abc", &T::abc, "cba", &T::cba, "abab", &T::abab, "baba", &T::baba);
+};
+
+suite key_hashing = [] {
+   "key hash"_test = [] {
+      // the lengths alone do not separate these keys, so bytes are mixed in
+      static constexpr auto h = glz::detail::key_hash_v<similar_keys>;
+      static_assert(h.valid);
+      static_assert(h.front != h.none || h.back != h.none);
+
+      expect(glz::detail::find_key<similar_keys>("ab") == 0);
+      expect(glz::detail::find_key<similar_keys>("baba") == 5);
+      expect(glz::detail::find_key<similar_keys>("abb") == 6);
+      expect(glz::detail::find_key<similar_keys>("") == 6);
+      expect(glz::detail::find_key<similar_keys>("abcde") == 6);
+      expect(glz::detail::find_key<my_struct>("hello") == 2);
+      expect(glz::detail::find_key<my_struct>("hellp") == 4);
+
+      similar_keys v{};
+      glz::read_json(v, std::string{R"({"baba":6,"cba":4,"ab":1,"abc":3,"ba":2,"abab":5,"bab":7})"});
+      expect(v.ab == 1 && v.ba == 2 && v.abc == 3 && v.cba == 4 && v.abab == 5 && v.baba == 6);
+   };
+};
+
+enum class sparse_code : int32_t { low = -100000, zero = 0, high = 100000 };
+
+template <>
+struct glz::meta<sparse_code>
+{
+   using enum sparse_code;
+   static constexpr auto value = enumerate("low", low, "zero", zero, "high", high);
+};
+
+enum class signed_level : int8_t { down = -2, flat = 0, up = 2 };
+
+template <>
+struct glz::meta<signed_level>
+{
+   using enum signed_level;
+   static constexpr auto value = enumerate("down", down, "flat", flat, "up", up);
+};
+
+suite enum_names = [] {
+   "dense enum"_test = [] {
+      std::vector<signed_level> v{signed_level::down, signed_level::up, signed_level::flat};
+      const auto buffer = glz::write_json(v);
+      expect(buffer == R"(["down","up","flat"])");
+      std::vector<signed_level> result{};
+      glz::read_json(result, buffer);
+      expect(result == v);
+
+      // a value without a name is written as its number
+      expect(glz::write_json(static_cast<signed_level>(1)) == "1");
+      expect(glz::write_json(static_cast<signed_level>(-100)) == "-100");
+   };
+
+   "sparse enum"_test = [] {
+      std::vector<sparse_code> v{sparse_code::high, sparse_code::low, sparse_code::zero};
+      const auto buffer = glz::write_json(v);
+      expect(buffer == R"(["high","low","zero"])");
+      std::vector<sparse_code> result{};
+      glz::read_json(result, buffer);
+      expect(result == v);
+
+      std::stringstream ss{R"([ "zero" , "low" ])"};
+      glz::read_json(result, ss);
+      expect(result == std::vector{sparse_code::zero, sparse_code::low});
+
+      sparse_code c{};
+      glz::context ctx{};
+      expect(glz::read_json(c, std::string{R"("lo")"}, ctx) == glz::error_code::unexpected_enum);
+   };
+};
+
+suite string_escapes = [] {
+   "unescape"_test = [] {
+      std::string s{};
+      glz::read_json(s, std::string{R"("tab\there\nnew \"q\" \\ \/ \b\f\r")"});
+      expect(s == "tab\there\nnew \"q\" \\ / \b\f\r");
+
+      glz::read_json(s, std::string{R"("A\u00e9\u20AC\ud83d\uDE00")"});
+      expect(s == "A\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80");
+
+      std::stringstream ss{R"("stream \u00E9\n")"};
+      glz::read_json(s, ss);
+      expect(s == "stream \xc3\xa9\n");
+
+      // decoded in place when viewed
+      std::string buffer = R"("a\u00e9\tb")";
+      std::string_view view{};
+      glz::read_json(view, buffer);
+      expect(view == "a\xc3\xa9\tb");
+
+      char c{};
+      glz::read_json(c, std::string{R"("\n")"});
+      expect(c == '\n');
+      glz::read_json(c, std::string{R"("A")"});
+      expect(c == 'A');
+      char32_t c32{};
+      glz::read_json(c32, std::string{R"("\u20ac")"});
+      expect(c32 == U'\x20AC');
+   };
+
+   "escape"_test = [] {
+      const std::string s = "tab\there \"q\" \\ \x01\x1f new\nline/";
+      const auto buffer = glz::write_json(s);
+      expect(buffer == R"("tab\there \"q\" \\ \u0001\u001f new\nline/")");
+      std::string result{};
+      glz::read_json(result, buffer);
+      expect(result == s);
+
+      // long clean runs around the escapes cross several vector blocks
+      std::vector<std::string> v{std::string(100, 'x') + "\r" + std::string(70, 'y'), std::string(65, '\b')};
+      std::string out{};
+      glz::write_json(v, out);
+      decltype(v) v2{};
+      glz::read_json(v2, out);
+      expect(v2 == v);
+
+      std::string raw(64, '\0');
+      raw.resize(glz::write<glz::opts{}>(s, raw.data()));
+      expect(raw == buffer);
+      expect(glz::write_json('\n') == R"("\n")");
+   };
+
+   "invalid strings"_test = [] {
+      std::string s{};
+      glz::context ctx{};
+      expect(glz::read_json(s, std::string{"\"raw\ttab\""}, ctx) == glz::error_code::unescaped_control_character);
+      expect(glz::read_json(s, std::string{R"("bad \x escape")"}, ctx) == glz::error_code::invalid_escape);
+      expect(glz::read_json(s, std::string{R"("\u12g4")"}, ctx) == glz::error_code::invalid_escape);
+      expect(glz::read_json(s, std::string{R"("\ud83d alone")"}, ctx) == glz::error_code::invalid_escape);
+      expect(glz::read_json(s, std::string{R"("\ude00")"}, ctx) == glz::error_code::invalid_escape);
+      std::stringstream ss{"\"line\nbreak\""};
+      expect(glz::read<glz::opts{}>(s, ss, ctx) == glz::error_code::unescaped_control_character);
+      char c{};
+      expect(glz::read_json(c, std::string{R"("\u00e9")"}, ctx) == glz::error_code::invalid_escape);
+   };
+};
+
+suite size_bounds = [] {
+   "fixed size bound"_test = [] {
+      static constexpr glz::opts opts{};
+      static_assert(glz::detail::fixed_json_size<circle, opts>);
+      static_assert(glz::detail::fixed_json_size<std::array<circle, 4>, opts>);
+      static_assert(!glz::detail::fixed_json_size<square, opts>);
+      const auto bound = glz::detail::to_json<circle>::fixed_size<opts>();
+      expect(glz::write_json(circle{-2.2250738585072014e-308}).size() <= bound);
+   };
+
+   "runtime size bound"_test = [] {
+      static constexpr glz::opts opts{};
+      static constexpr glz::opts commented{.comments = true};
+      Thing thing{};
+      expect(glz::write_json(thing).size() <= glz::detail::write<glz::json>::size_bound<opts>(thing));
+      expect(glz::write_jsonc(thing).size() <= glz::detail::write<glz::json>::size_bound<commented>(thing));
+
+      std::vector<shape> shapes{circle{1.5}, square{2.0, "quote \" tab \t"}};
+      expect(glz::write_json(shapes).size() <= glz::detail::write<glz::json>::size_bound<opts>(shapes));
+      expect(glz::detail::write<glz::json>::size_bound<opts>(std::string{"a\"b\x01"}) == 12);
+   };
+
+   "bounded write"_test = [] {
+      std::map<std::string, std::vector<std::optional<int64_t>>> value{
+         {"min", {std::numeric_limits<int64_t>::min(), std::nullopt}}, {"max", {std::numeric_limits<int64_t>::max()}}};
+      std::string buffer{};
+      glz::write_json(value, buffer);
+      expect(buffer == R"({"max":[9223372036854775807],"min":[-9223372036854775808,null]})");
+      const auto tuple = std::make_tuple(uint64_t(18446744073709551615u), std::string{"\x1f"}, false);
+      expect(glz::write_json(tuple) == R"([18446744073709551615,"\u001f",false])");
+   };
+};
+
+suite number_writing = [] {
+   "integers"_test = [] {
+      expect(glz::write_json(std::numeric_limits<int64_t>::min()) == "-9223372036854775808");
+      expect(glz::write_json(std::numeric_limits<uint64_t>::max()) == "18446744073709551615");
+      expect(glz::write_json(std::vector<int>{0, 9, 10, 99, 100, -1, -100000}) == "[0,9,10,99,100,-1,-100000]");
+      expect(glz::write_json(int8_t{-128}) == "-128");
+   };
+
+   "floating point"_test = [] {
+      expect(glz::write_json(std::vector<double>{0.1, -0.0, 2.0, 1e15, 1e16, 1e-4, 1e-5, 5e-324}) ==
+             "[0.1,-0,2,1000000000000000,1e+16,0.0001,1e-05,5e-324]");
+      expect(glz::write_json(std::numeric_limits<double>::max()) == "1.7976931348623157e+308");
+      expect(glz::write_json(3.4028235e38f) == "3.4028235e+38");
+      expect(glz::write_json(0.3f) == "0.3");
+
+      std::mt19937_64 generator{};
+      for (size_t i = 0; i < 1000; ++i) {
+         const auto bits = generator();
+         double x{};
+         std::memcpy(&x, &bits, sizeof(x));
+         if (!std::isfinite(x)) {
+            continue;
+         }
+         double y{};
+         glz::read_json(y, glz::write_json(x));
+         expect(x == y);
+      }
+   };
+};
+
+suite pretty_writing = [] {
+   "example"_test = [] {
+      std::string buffer{};
+      glz::write<glz::opts{.prettify = true}>(my_struct{}, buffer);
+      expect(buffer == R"({
+   "i": 287,
+   "d": 3.14,
+   "hello": "Hello World",
+   "arr": [
+      1,
+      2,
+      3
+   ]
+})");
+   };
+
+   "matches prettify"_test = [] {
+      Thing thing{};
+      thing.array[0] = "asdf"; // prettify does not follow escaped quotes
+      std::string buffer{};
+      glz::write<glz::opts{.prettify = true}>(thing, buffer);
+      expect(buffer == glz::prettify(glz::write_json(thing)));
+
+      glz::write<glz::opts{.comments = true, .prettify = true}>(thing, buffer);
+      expect(buffer == glz::prettify(glz::write_jsonc(thing)));
+
+      std::vector<shape> shapes{circle{1.5}, square{2.0, "box"}};
+      glz::write<glz::opts{.prettify = true, .indentation_char = '\t', .indentation_width = 1}>(shapes, buffer);
+      expect(buffer == glz::prettify(glz::write_json(shapes), true));
+   };
+
+   "empty values"_test = [] {
+      std::map<std::string, std::vector<int>> value{{"a", {}}, {"b", {1}}};
+      std::string buffer{};
+      glz::write<glz::opts{.prettify = true}>(value, buffer);
+      expect(buffer == R"({
+   "a": [],
+   "b": [
+      1
+   ]
+})");
+      glz::write<glz::opts{.prettify = true}>(std::map<int, int>{}, buffer);
+      expect(buffer == "{}");
+   };
+};
+
+suite fixed_buffer_writing = [] {
+   "measure"_test = [] {
+      Thing thing{};
+      expect(glz::measure_json(thing) == glz::write_json(thing).size());
+      std::vector<shape> shapes{circle{1.5}, square{2.0, "tab\t"}};
+      expect(glz::measure_json(shapes) == glz::write_json(shapes).size());
+      std::string pretty{};
+      glz::write<glz::opts{.prettify = true}>(thing, pretty);
+      expect(glz::measure_json<glz::opts{.prettify = true}>(thing) == pretty.size());
+   };
+
+   "span"_test = [] {
+      my_struct s{};
+      std::array<char, 128> slot{};
+      const auto result = glz::write_json(s, std::span<char>{slot});
+      expect(!result);
+      expect(std::string_view{slot.data(), result.size} == R"({"i":287,"d":3.14,"hello":"Hello World","arr":[1,2,3]})");
+
+      std::array<char, 16> small{};
+      const auto overflow = glz::write_json(s, std::span<char>{small});
+      expect(overflow == glz::error_code::buffer_overflow);
+      expect(overflow.size == glz::measure_json(s));
+      expect(small == std::array<char, 16>{});
+
+      // the size bound does not fit, but the exact size does
+      std::vector<double> values{1.5, 2.5};
+      std::array<char, 9> exact{};
+      const auto fitted = glz::write<glz::opts{}>(values, std::span<char>{exact});
+      expect(!fitted);
+      expect(std::string_view{exact.data(), fitted.size} == "[1.5,2.5]");
+   };
+};
+
+// a stream that cannot seek and hands out its input in chunks, like a pipe, and notes reads past the last chunk
+struct chunked_buf : std::streambuf
+{
+   std::vector<std::string> chunks{};
+   size_t next{};
+   bool waited{};
+
+   int_type underflow() override
+   {
+      if (next == chunks.size()) {
+         waited = true;
+         return traits_type::eof();
+      }
+      auto& chunk = chunks[next++];
+      setg(chunk.data(), chunk.data(), chunk.data() + chunk.size());
+      return traits_type::to_int_type(chunk[0]);
+   }
+};
+
+suite stream_reading = [] {
+   "large stream"_test = [] {
+      // strings, numbers and skipped values straddle the 64 KiB block boundaries
+      std::vector<std::string> v(5000, std::string(37, 'x'));
+      for (size_t i = 0; i < v.size(); i += 7) {
+         v[i] += "\"\\";
+      }
+      std::stringstream ss{glz::write_json(v)};
+      std::vector<std::string> result{};
+      glz::read_json(result, ss);
+      expect(result == v);
+
+      std::map<std::string, std::vector<double>> m{};
+      for (size_t i = 0; i < 3000; ++i) {
+         m["key" + std::to_string(i)] = {1.5, double(i), -3.25};
+      }
+      std::stringstream ms{glz::write_json(m)};
+      decltype(m) m2{};
+      glz::read_json(m2, ms);
+      expect(m2 == m);
+   };
+
+   "records stream"_test = [] {
+      // keys and numbers are read in place within a block and through the iterator where they cross into the next
+      std::vector<my_struct> v(4000);
+      for (size_t i = 0; i < v.size(); ++i) {
+         v[i].d = -0.125 * double(i);
+         v[i].arr = {i, i * 1000003, uint64_t(1) << (i % 64)};
+      }
+      std::stringstream ss{glz::write_json(v)};
+      std::vector<my_struct> result{};
+      glz::read_json(result, ss);
+      expect(result.size() == v.size());
+      bool same = true;
+      for (size_t i = 0; i < v.size(); ++i) {
+         same &= result[i].d == v[i].d && result[i].arr == v[i].arr;
+      }
+      expect(same);
+   };
+
+   "raw_json stream"_test = [] {
+      std::stringstream ss{R"([{"a":[1,"]"]},[2,{}],3] trailing)"};
+      std::vector<glz::raw_json> v{};
+      glz::read_json(v, ss);
+      expect(v.size() == 3);
+      expect(v[0].str == R"({"a":[1,"]"]})");
+      expect(v[1].str == "[2,{}]");
+      std::string rest{};
+      ss >> rest;
+      expect(rest == "trailing");
+   };
+
+   "values from a pipe"_test = [] {
+      chunked_buf buf{};
+      buf.chunks = {"[1,2] [3", "]"};
+      std::istream is{&buf};
+      std::vector<int> v{};
+      glz::read_json(v, is);
+      expect(v == std::vector<int>{1, 2});
+      expect(buf.next == 1);
+      glz::read_json(v, is);
+      expect(v == std::vector<int>{3});
+      expect(!buf.waited);
+   };
+
+   "stream error"_test = [] {
+      std::stringstream ss{R"({"d":1.5,"arr":[1,2,x]})"};
+      my_struct obj{};
+      glz::context ctx{};
+      const auto pe = glz::read<glz::opts{}>(obj, ss, ctx);
+      expect(pe == glz::error_code::parse_number_failure);
+      expect(pe.location == 20);
+   };
+
+#if defined(__unix__) || defined(__APPLE__)
+   "file descriptor"_test = [] {
+      const std::string path = "glaze_fd_test.json";
+      {
+         std::ofstream file{path};
+         file << R"({"d":0.5,"hello":"fd","arr":[3,2,1]})";
+      }
+      const int fd = ::open(path.c_str(), O_RDONLY);
+      expect(fd >= 0);
+      my_struct obj{};
+      glz::read<glz::opts{}>(obj, glz::fd_source{fd});
+      ::close(fd);
+      std::remove(path.c_str());
+      expect(obj.hello == "fd");
+      expect(obj.arr == std::array<uint64_t, 3>{3, 2, 1});
+   };
+
+   "file descriptor error"_test = [] {
+      const int fd = ::open(".", O_RDONLY); // reading a directory fails
+      expect(fd >= 0);
+      my_struct obj{};
+      glz::context ctx{};
+      const auto pe = glz::read<glz::opts{}>(obj, glz::fd_source{fd}, ctx);
+      ::close(fd);
+      expect(pe == glz::error_code::read_failure);
+   };
+#endif
 };
 
 suite json_helpers = [] {
@@ -1804,6 +2923,56 @@ suite allocated_write = [] {
    };
 };
 
+suite lazy_json = [] {
+   "lazy_json_access"_test = [] {
+      const std::string buffer =
+         R"( {"skip":{"x":[1,{"y":"}"}]},"a":{"b":[10, 20.5 ,"str"]},"c/d":true,"e~f":null,"esc\"key":3} )";
+      glz::lazy_json doc{buffer};
+      expect(doc.type() == glz::json_type::object);
+      expect(doc.size() == 5);
+      expect(doc["a"]["b"][0].get<int>() == 10);
+      expect(doc.at("/a/b/1").get<double>() == 20.5);
+      expect(doc.at("/a/b/2").get<std::string>() == "str");
+      expect(doc.at("/c~1d").get<bool>());
+      expect(doc.at("/e~0f").type() == glz::json_type::null);
+      expect(doc["esc\"key"].get<int>() == 3);
+      expect(doc.at("").json == doc.json);
+
+      expect(!doc["missing"]);
+      expect(!doc.at("/a/b/3"));
+      expect(!doc.at("/a/b/x"));
+      expect(!doc.at("/a/b/0/z"));
+   };
+
+   "lazy_json_iterate"_test = [] {
+      const std::string buffer = R"({"a":1,"b":[true,false],"c":{}})";
+      glz::lazy_json doc{buffer};
+      std::vector<std::string_view> keys{};
+      for (auto&& [key, value] : doc) {
+         keys.emplace_back(key);
+      }
+      expect(keys == std::vector<std::string_view>{"a", "b", "c"});
+
+      std::vector<bool> flags{};
+      for (auto&& element : doc["b"]) {
+         flags.emplace_back(element.value.get<bool>());
+      }
+      expect(flags == std::vector<bool>{true, false});
+      expect(doc["c"].size() == 0);
+      expect(glz::lazy_json{std::string_view{"[]"}}.size() == 0);
+   };
+
+   "lazy_json_get_without_throwing"_test = [] {
+      const std::string buffer = R"({"v":[1,2,3],"bad":[1,}"})";
+      glz::lazy_json doc{buffer};
+      std::vector<int> v{};
+      expect(!doc["v"].get(v));
+      expect(v == std::vector<int>{1, 2, 3});
+      std::string s{};
+      expect(bool(doc["v"].get(s)));
+   };
+};
+
 int main()
 {
    using namespace boost::ut;